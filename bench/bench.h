@@ -0,0 +1,44 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    /// Run `fn` `iterations` times after a short warm-up and print the median and
+    /// fastest time per call, in microseconds. Returns the median.
+    template <class Fn>
+    double measure(const char* name, int iterations, Fn&& fn)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        for (int i = 0; i < std::max(1, iterations / 10); ++i) fn();
+
+        std::vector<double> times;
+        times.reserve(iterations);
+        for (int i = 0; i < iterations; ++i) {
+            auto start = Clock::now();
+            fn();
+            times.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+        }
+        std::sort(times.begin(), times.end());
+
+        double median = times[times.size() / 2];
+        std::printf("  %-44s median %9.2f us   min %9.2f us\n", name, median, times.front());
+        return median;
+    }
+
+    /// Whole file as a string ("" if it cannot be read)
+    std::string readFile(const std::string& path);
+
+    /// Copy `from` to `to`. Returns false on error.
+    bool copyFile(const std::string& from, const std::string& to);
+
+    // One function per benchmarked change (see main.cpp)
+    void iniReader();
+    void settingsCache();
+    void configWatcher();
+}
@@ -0,0 +1,95 @@
+#include "bench.h"
+#include "vrui/VRUIConfigWatcher.h"
+#include "vrui/VRUISettings.h"
+#include "vrui/VRUISettingsWriter.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace vrui;
+
+namespace bench
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        /// Milliseconds until the watcher hands over a snapshot, or -1 after `timeoutMs`
+        double waitForSnapshot(VRUIConfigWatcher& watcher, int timeoutMs, std::unique_ptr<VRUISettings>* out = nullptr)
+        {
+            auto start = Clock::now();
+            while (Clock::now() - start < std::chrono::milliseconds(timeoutMs)) {
+                if (auto snapshot = watcher.poll()) {
+                    if (out) *out = std::move(snapshot);
+                    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            return -1.0;
+        }
+
+        void writeText(const std::string& path, const std::string& text)
+        {
+            std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+        }
+    }
+
+    /// Polling backend of the INI watcher on a copy of the shipped INI: how long an edit
+    /// takes to arrive, and that the plugin's own saves and delete-then-rename saves are
+    /// handled (no reload of our own write, no defaults written over the user's file)
+    void configWatcher()
+    {
+        constexpr int kTimeoutMs = 3000;
+
+        auto dir = std::filesystem::temp_directory_path() / "ImmersiveUI_bench_watch";
+        std::filesystem::create_directories(dir);
+        auto iniPath = (dir / "ImmersiveUI.ini").string();
+        if (!copyFile("ImmersiveUI.ini", iniPath)) {
+            std::printf("config watcher: cannot copy ImmersiveUI.ini (run from the project directory)\n");
+            return;
+        }
+        auto original = readFile(iniPath);
+
+        std::printf("config watcher (polling every %u ms, %u ms debounce)\n",
+            VRUIConfigWatcher::kPollIntervalMs, VRUIConfigWatcher::kDebounceMs);
+
+        auto& watcher = VRUIConfigWatcher::get();
+        watcher.start(iniPath, VRUIConfigWatcher::Backend::Polling);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));  // Let the thread take its baseline
+
+        // 1. An external edit arrives as one parsed snapshot
+        writeText(iniPath, original + "\n[Bench]\nfEdited = 1\n");
+        std::unique_ptr<VRUISettings> snapshot;
+        double latency = waitForSnapshot(watcher, kTimeoutMs, &snapshot);
+        std::printf("  external edit: %s after %.0f ms\n", snapshot ? "reloaded" : "NOT reloaded", latency);
+
+        // 2. The plugin's own save is not reloaded
+        VRUISettings settings;
+        settings.menuScale = snapshot ? snapshot->menuScale * 1.5f : 1.5f;
+        auto error = VRUISettingsWriter::writeFileAtomic(iniPath, settings.serialize());
+        bool ownReloaded = waitForSnapshot(watcher, kTimeoutMs) >= 0.0;
+        std::printf("  own save: %s\n", !error.empty() ? error.c_str() : ownReloaded ? "RELOADED (reverts later edits)" : "ignored");
+
+        // 3. Delete-then-rename save: the file is missing for a moment and must not be
+        //    replaced with defaults
+        std::filesystem::remove(iniPath);
+        std::this_thread::sleep_for(std::chrono::milliseconds(VRUIConfigWatcher::kPollIntervalMs + 100));
+        auto edited = original + "\n; saved by an editor\n";
+        writeText(iniPath + ".new", edited);
+        std::filesystem::rename(iniPath + ".new", iniPath);
+        latency = waitForSnapshot(watcher, kTimeoutMs);
+        std::printf("  delete-then-rename: %s after %.0f ms, file %s\n", latency >= 0.0 ? "reloaded" : "NOT reloaded",
+            latency, readFile(iniPath) == edited ? "kept" : "OVERWRITTEN");
+
+        watcher.stop();
+        auto stats = watcher.getStats();
+        std::printf("  %llu changes seen, %llu parsed, %llu replaced before collection\n\n",
+            static_cast<unsigned long long>(stats.changes), static_cast<unsigned long long>(stats.parses),
+            static_cast<unsigned long long>(stats.replaced));
+
+        // The thread exits within one poll interval
+        std::this_thread::sleep_for(std::chrono::milliseconds(VRUIConfigWatcher::kPollIntervalMs + 100));
+        std::filesystem::remove_all(dir);
+    }
+}
@@ -0,0 +1,82 @@
+#include "bench.h"
+#include "vrui/VRUIIniReader.h"
+#include "vrui/VRUISettings.h"
+#include "vrui/VRUISettingsCache.h"
+#include "vrui/VRUISettingsSchema.h"
+#include <CLIBUtil/simpleINI.hpp>
+
+using namespace vrui;
+
+namespace bench
+{
+    namespace
+    {
+        /// The reader VRUIIniReader replaced: CSimpleIniA, one lookup per schema key and per
+        /// slot key (for the `slotCount` slots the file defines)
+        void loadWithSimpleIni(const std::string& path, int slotCount, VRUISettings& settings)
+        {
+            CSimpleIniA ini;
+            ini.SetUnicode();
+            if (ini.LoadFile(path.c_str()) < 0) return;
+
+            for (const auto& field : settingsSchema()) {
+                switch (field.type) {
+                case SettingField::Type::Bool:
+                    settings.*field.boolMember = ini.GetBoolValue(field.section, field.key, settings.*field.boolMember);
+                    break;
+                case SettingField::Type::Int:
+                    settings.*field.intMember = static_cast<int>(ini.GetLongValue(field.section, field.key, settings.*field.intMember));
+                    break;
+                case SettingField::Type::Float:
+                    settings.*field.floatMember = static_cast<float>(ini.GetDoubleValue(field.section, field.key, settings.*field.floatMember));
+                    break;
+                case SettingField::Type::String:
+                    settings.*field.stringMember = ini.GetValue(field.section, field.key, (settings.*field.stringMember).c_str());
+                    break;
+                case SettingField::Type::SlotStrings:
+                    for (int i = 0; i < slotCount; ++i) {
+                        char key[64];
+                        std::snprintf(key, sizeof(key), "sSlot%d%s", i + 1, field.key);
+                        if (const char* value = ini.GetValue(field.section, key, nullptr)) {
+                            settings.slots.set(i, field.slotMember, value);
+                        }
+                    }
+                    break;
+                }
+            }
+            settings.validate();
+        }
+
+        void compare(const char* name, const std::string& path, int slotCount, int iterations)
+        {
+            std::printf("INI reader (%s, %zu bytes, %d slots)\n", name, readFile(path).size(), slotCount);
+
+            double before = measure("before: CSimpleIniA + validate", iterations, [&]() {
+                VRUISettings settings;
+                loadWithSimpleIni(path, slotCount, settings);
+            });
+            double after = measure("after: VRUIIniReader + validate", iterations, [&]() {
+                VRUISettings settings;
+                VRUIIniReader::load(path, settings);
+                settings.validate();
+            });
+
+            VRUISettings old;
+            loadWithSimpleIni(path, slotCount, old);
+            VRUISettings current;
+            VRUIIniReader::load(path, current);
+            current.validate();
+            std::printf("  %.1fx faster; results %s\n\n", before / after,
+                VRUISettingsCache::encode(old) == VRUISettingsCache::encode(current) ? "match" : "DIFFER");
+        }
+    }
+
+    /// VRUIIniReader against the CSimpleIniA reader it replaced, on the shipped INI and on
+    /// bench/data/ImmersiveUI_10x.ini: the same settings sections with 477 filled-in slots
+    /// (53 pages), about ten times the size
+    void iniReader()
+    {
+        compare("ImmersiveUI.ini", "ImmersiveUI.ini", 36, 1000);
+        compare("ImmersiveUI_10x.ini", "bench/data/ImmersiveUI_10x.ini", 477, 200);
+    }
+}
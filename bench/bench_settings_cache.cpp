@@ -0,0 +1,59 @@
+#include "bench.h"
+#include "vrui/VRUIIniReader.h"
+#include "vrui/VRUIMappedFile.h"
+#include "vrui/VRUISettings.h"
+#include "vrui/VRUISettingsCache.h"
+#include <filesystem>
+
+using namespace vrui;
+
+namespace bench
+{
+    /// Settings load before the binary cache (map, parse, validate) and after it
+    /// (map, hash, decode), on the shipped INI
+    void settingsCache()
+    {
+        constexpr int kIterations = 2000;
+
+        auto dir = std::filesystem::temp_directory_path() / "ImmersiveUI_bench";
+        std::filesystem::create_directories(dir);
+        auto iniPath = (dir / "ImmersiveUI.ini").string();
+        if (!copyFile("ImmersiveUI.ini", iniPath)) {
+            std::printf("settings cache: cannot copy ImmersiveUI.ini (run from the project directory)\n");
+            return;
+        }
+        auto cachePath = VRUISettingsCache::pathFor(iniPath);
+        std::filesystem::remove(cachePath);
+
+        std::printf("settings cache (ImmersiveUI.ini, %zu bytes)\n", readFile(iniPath).size());
+
+        double parse = measure("before: map + parse + validate", kIterations, [&]() {
+            VRUISettings settings;
+            VRUIMappedFile file;
+            file.open(iniPath);
+            VRUIIniReader::parse(file.view(), settings);
+            settings.validate();
+        });
+
+        VRUISettings{}.load(iniPath);  // Writes the cache
+        double cached = measure("after: load() with a valid cache", kIterations, [&]() {
+            VRUISettings settings;
+            settings.load(iniPath);
+        });
+        // Includes writing the cache file, which is flushed to disk before the rename
+        measure("after: load() with no cache (parse + write)", kIterations / 10, [&]() {
+            std::filesystem::remove(cachePath);
+            VRUISettings settings;
+            settings.load(iniPath);
+        });
+
+        VRUISettings parsed;
+        VRUIIniReader::load(iniPath, parsed);
+        parsed.validate();
+        VRUISettings loaded;
+        loaded.load(iniPath);
+        std::printf("  cache hit is %.1fx faster than parsing; results %s\n\n", parse / cached,
+            VRUISettingsCache::encode(parsed) == VRUISettingsCache::encode(loaded) ? "match" : "DIFFER");
+        std::filesystem::remove_all(dir);
+    }
+}
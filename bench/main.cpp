@@ -0,0 +1,36 @@
+#include "bench.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+// Benchmarks for code that runs without the game: build with `xmake f --bench=y`, then
+// `xmake build ImmersiveUI_bench` and `xmake run ImmersiveUI_bench` (runs from the
+// project directory, so ImmersiveUI.ini and bench/data are found). Temporary files go
+// to the system temp directory.
+
+namespace bench
+{
+    std::string readFile(const std::string& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::ostringstream text;
+        text << in.rdbuf();
+        return text.str();
+    }
+
+    bool copyFile(const std::string& from, const std::string& to)
+    {
+        std::error_code ec;
+        std::filesystem::copy_file(from, to, std::filesystem::copy_options::overwrite_existing, ec);
+        return !ec;
+    }
+}
+
+int main()
+{
+    logger::set_level(logger::level::warn);  // The code under test logs every load
+    bench::iniReader();
+    bench::settingsCache();
+    bench::configWatcher();
+    return 0;
+}
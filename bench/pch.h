@@ -0,0 +1,98 @@
+#pragma once
+
+// Precompiled header of ImmersiveUI_bench. The benchmarked sources only need the
+// standard library and the pch's `logger`, so this stands in for src/pch.h without
+// CommonLib, REL or SKSE and builds on Linux as well as Windows.
+
+#include <algorithm>
+#include <cmath>  // CLIBUtil/hash.hpp uses std::floor and std::sqrt without including it
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if __has_include(<format>)
+#include <format>
+#else
+#include <functional>
+#include <sstream>
+#include <vector>
+#endif
+
+using namespace std::literals;
+using namespace std;
+
+namespace logger
+{
+    enum class level
+    {
+        trace,
+        debug,
+        info,
+        warn,
+        err,
+        critical,
+        off
+    };
+
+    /// Messages below this level are dropped (the code under test logs every load)
+    inline level& threshold()
+    {
+        static level value = level::info;
+        return value;
+    }
+
+    inline void set_level(level value) { threshold() = value; }
+
+    template <class... Args>
+    std::string format(std::string_view format, const Args&... args)
+    {
+#if __has_include(<format>)
+        return std::vformat(format, std::make_format_args(args...));
+#else
+        // No <format> (GCC 12): each {...} is replaced by the next argument as streamed
+        std::vector<std::function<void(std::ostream&)>> values{ [&args](std::ostream& out) { out << args; }... };
+        std::ostringstream out;
+        std::size_t next = 0;
+        for (std::size_t i = 0; i < format.size(); ++i) {
+            char c = format[i];
+            if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c) {
+                out << c;
+                ++i;
+            } else if (c == '{') {
+                i = std::min(format.find('}', i), format.size());
+                if (next < values.size()) values[next++](out);
+            } else {
+                out << c;
+            }
+        }
+        return out.str();
+#endif
+    }
+
+    template <class... Args>
+    void log(level at, std::string_view format, const Args&... args)
+    {
+        if (at < threshold()) return;
+        auto text = logger::format(format, args...);
+        std::fprintf(stderr, "%.*s\n", static_cast<int>(text.size()), text.data());
+    }
+
+    template <class... Args>
+    void trace(std::string_view format, const Args&... args) { log(level::trace, format, args...); }
+
+    template <class... Args>
+    void debug(std::string_view format, const Args&... args) { log(level::debug, format, args...); }
+
+    template <class... Args>
+    void info(std::string_view format, const Args&... args) { log(level::info, format, args...); }
+
+    template <class... Args>
+    void warn(std::string_view format, const Args&... args) { log(level::warn, format, args...); }
+
+    template <class... Args>
+    void error(std::string_view format, const Args&... args) { log(level::err, format, args...); }
+
+    template <class... Args>
+    void critical(std::string_view format, const Args&... args) { log(level::critical, format, args...); }
+}
@@ -31,10 +31,15 @@ namespace ImmersiveUI_API
     // Callback types
     using ButtonPressCallback = std::function<void()>;
     using ToggleCallback = std::function<void(bool)>;
+    using SlotActionCallback = std::function<void(const char* argument, int slotIndex)>;
 
     enum class InterfaceVersion : uint8_t
     {
-        V1
+        V1,
+        Resources1,  // IVImmersiveUIResources1
+        Resources2,  // IVImmersiveUIResources2
+        Settings1,   // IVImmersiveUISettings1
+        Actions1     // IVImmersiveUIActions1
     };
 
     /// Public API interface v1
@@ -101,6 +106,103 @@ namespace ImmersiveUI_API
         virtual void SetPanelScale(PanelHandle panel, float scale) noexcept = 0;
     };
 
+    /// Counters of the NIF model cache (see IVImmersiveUIResources1::GetModelCacheStats)
+    struct ModelCacheStats
+    {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        uint32_t entries;
+        uint32_t pinned;        // Entries exempt from eviction
+        uint32_t maxEntries;    // Budget for unpinned entries, 0 = unlimited
+        uint64_t bytes;         // Estimated memory held by cached models
+        uint64_t peakBytes;
+        uint64_t budgetBytes;   // Budget for unpinned entries, 0 = unlimited
+    };
+
+    /// Resources interface v1: model cache statistics and sizing.
+    /// Request with InterfaceVersion::Resources1. Call from the main thread.
+    class IVImmersiveUIResources1
+    {
+    public:
+        /// Fill `out` with the current model cache counters
+        virtual void GetModelCacheStats(ModelCacheStats& out) noexcept = 0;
+
+        /// Set the model cache budget (0 = unlimited for that dimension)
+        virtual void SetModelCacheBudget(uint32_t maxEntries, uint64_t budgetBytes) noexcept = 0;
+
+        /// Pin (or unpin) a model so it is never evicted. Can be called before the model is loaded.
+        /// @param nifPath     Path to NIF mesh relative to Data/Meshes/
+        virtual void PinModel(const char* nifPath, bool pinned) noexcept = 0;
+    };
+
+    /// Availability of a registered asset (see IVImmersiveUIResources2::GetAssetStatus)
+    enum class AssetStatus : uint8_t
+    {
+        Unknown,    // Not registered, or not validated yet
+        Available,
+        Missing
+    };
+
+    /// Resources interface v2: v1 plus asset manifest registration.
+    /// Request with InterfaceVersion::Resources2. Call from the main thread.
+    class IVImmersiveUIResources2 : public IVImmersiveUIResources1
+    {
+    public:
+        /// Add a mesh to the startup manifest: validated and warmed with ImmersiveUI's own assets
+        /// at kDataLoaded (immediately if registered later), and listed in the report if missing.
+        /// @param nifPath     Path to NIF mesh relative to Data/Meshes/
+        /// @param critical    Warm before the menu's own slot meshes
+        virtual void RegisterMesh(const char* nifPath, bool critical) noexcept = 0;
+
+        /// Add a texture to the startup manifest
+        /// @param ddsPath     Path to DDS texture relative to Data/ (textures\ prefix optional)
+        virtual void RegisterTexture(const char* ddsPath) noexcept = 0;
+
+        /// Validation result for a registered mesh or texture
+        virtual AssetStatus GetAssetStatus(const char* path, bool isTexture) noexcept = 0;
+    };
+
+    /// Settings interface v1: settings profiles.
+    /// Request with InterfaceVersion::Settings1. Call from the main thread.
+    class IVImmersiveUISettings1
+    {
+    public:
+        /// Number of profiles in Data/SKSE/Plugins/ImmersiveUI/Profiles (read at startup)
+        virtual uint32_t GetProfileCount() noexcept = 0;
+
+        /// Name of profile `index` (sorted by name), or nullptr if out of range.
+        /// Valid until the next call into this interface.
+        virtual const char* GetProfileName(uint32_t index) noexcept = 0;
+
+        /// Active profile ("" = ImmersiveUI.ini alone). Valid until the next call into this interface.
+        virtual const char* GetActiveProfile() noexcept = 0;
+
+        /// Switch profile ("" or nullptr = ImmersiveUI.ini alone). Takes effect at the start of
+        /// the next frame; only what differs is rebuilt. Returns false if there is no such profile.
+        virtual bool SetActiveProfile(const char* name) noexcept = 0;
+    };
+
+    /// Actions interface v1: slot actions other plugins provide.
+    /// Request with InterfaceVersion::Actions1. Call from the main thread.
+    ///
+    /// A slot set to "Name" or "Name:argument" in ImmersiveUI.ini (key sSlot<N>, e.g.
+    /// "sSlot1 = Name:argument") calls the callback registered as "Name" (case-insensitive)
+    /// with the text after the ':' and the 0-based slot index. ImmersiveUI's own actions (Map, Close, Console, ...) cannot be replaced.
+    class IVImmersiveUIActions1
+    {
+    public:
+        /// Register action `name` for plugin `owner`. Slots already built pick it up next frame.
+        /// Returns false if the name is taken (by ImmersiveUI or another plugin).
+        virtual bool RegisterAction(const char* owner, const char* name, SlotActionCallback callback) noexcept = 0;
+
+        /// Remove action `name` if `owner` registered it
+        virtual bool UnregisterAction(const char* owner, const char* name) noexcept = 0;
+
+        /// Whether any plugin (or ImmersiveUI) provides action `name`
+        virtual bool HasAction(const char* name) noexcept = 0;
+    };
+
     // Internal: function pointer type for API request
     typedef void* (*_RequestPluginAPI)(const InterfaceVersion interfaceVersion);
 
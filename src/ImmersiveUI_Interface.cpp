@@ -0,0 +1,140 @@
+#include "ImmersiveUI_Interface.h"
+#include "vrui/VRUIModelCache.h"
+#include "vrui/VRUIAssetManifest.h"
+#include "vrui/VRMenuManager.h"
+#include "vrui/VRUISettingsProfiles.h"
+#include "vrui/VRUIActionRegistry.h"
+#include <string_view>
+
+namespace ImmersiveUI_API
+{
+    ResourcesInterface* ResourcesInterface::GetSingleton()
+    {
+        static ResourcesInterface instance;
+        return &instance;
+    }
+
+    void ResourcesInterface::GetModelCacheStats(ModelCacheStats& out) noexcept
+    {
+        const auto& cache = vrui::VRUIModelCache::get();
+        const auto& stats = cache.getStats();
+
+        out.hits = stats.hits;
+        out.misses = stats.misses;
+        out.evictions = stats.evictions;
+        out.entries = static_cast<uint32_t>(stats.entries);
+        out.pinned = static_cast<uint32_t>(stats.pinned);
+        out.maxEntries = static_cast<uint32_t>(cache.getMaxEntries());
+        out.bytes = stats.bytes;
+        out.peakBytes = stats.peakBytes;
+        out.budgetBytes = cache.getMaxBytes();
+    }
+
+    void ResourcesInterface::SetModelCacheBudget(uint32_t maxEntries, uint64_t budgetBytes) noexcept
+    {
+        logger::info("ImmersiveUI: API set model cache budget to {} entries / {} bytes", maxEntries, budgetBytes);
+        vrui::VRUIModelCache::get().setBudget(maxEntries, static_cast<std::size_t>(budgetBytes));
+    }
+
+    void ResourcesInterface::PinModel(const char* nifPath, bool pinned) noexcept
+    {
+        if (!nifPath || !*nifPath) return;
+        vrui::VRUIModelCache::get().pin(nifPath, pinned);
+    }
+
+    void ResourcesInterface::RegisterMesh(const char* nifPath, bool critical) noexcept
+    {
+        if (!nifPath || !*nifPath) return;
+        using Manifest = vrui::VRUIAssetManifest;
+        Manifest::get().add(nifPath, Manifest::Kind::Mesh,
+            critical ? Manifest::Priority::Critical : Manifest::Priority::Menu, "API");
+    }
+
+    void ResourcesInterface::RegisterTexture(const char* ddsPath) noexcept
+    {
+        if (!ddsPath || !*ddsPath) return;
+        using Manifest = vrui::VRUIAssetManifest;
+        Manifest::get().add(ddsPath, Manifest::Kind::Texture, Manifest::Priority::Menu, "API");
+    }
+
+    AssetStatus ResourcesInterface::GetAssetStatus(const char* path, bool isTexture) noexcept
+    {
+        if (!path || !*path) return AssetStatus::Unknown;
+        using Manifest = vrui::VRUIAssetManifest;
+        switch (Manifest::get().getStatus(path, isTexture ? Manifest::Kind::Texture : Manifest::Kind::Mesh)) {
+        case Manifest::Status::Available:
+            return AssetStatus::Available;
+        case Manifest::Status::Missing:
+            return AssetStatus::Missing;
+        default:
+            return AssetStatus::Unknown;
+        }
+    }
+
+    SettingsInterface* SettingsInterface::GetSingleton()
+    {
+        static SettingsInterface instance;
+        return &instance;
+    }
+
+    uint32_t SettingsInterface::GetProfileCount() noexcept
+    {
+        return static_cast<uint32_t>(vrui::VRUISettingsProfiles::get().count());
+    }
+
+    const char* SettingsInterface::GetProfileName(uint32_t index) noexcept
+    {
+        const auto& profiles = vrui::VRUISettingsProfiles::get();
+        if (index >= profiles.count()) return nullptr;
+        _name = profiles.nameAt(index);
+        return _name.c_str();
+    }
+
+    const char* SettingsInterface::GetActiveProfile() noexcept
+    {
+        _name = vrui::VRUISettings::get().activeProfile;
+        return _name.c_str();
+    }
+
+    bool SettingsInterface::SetActiveProfile(const char* name) noexcept
+    {
+        logger::info("ImmersiveUI: API switch to settings profile '{}'", name ? name : "");
+        return vrui::VRMenuManager::get().setProfile(name ? name : "");
+    }
+
+    ActionsInterface* ActionsInterface::GetSingleton()
+    {
+        static ActionsInterface instance;
+        return &instance;
+    }
+
+    bool ActionsInterface::RegisterAction(const char* owner, const char* name, SlotActionCallback callback) noexcept
+    {
+        if (!owner || !*owner || std::string_view(owner) == PluginName || !name || !callback) return false;
+
+        auto factory = [callback = std::move(callback)](const vrui::VRUIActionRegistry::Context& ctx) -> vrui::VRUIButton::PressCallback {
+            return [callback, argument = std::string(ctx.argument), slot = ctx.slotIndex](vrui::VRUIButton*) {
+                callback(argument.c_str(), slot);
+            };
+        };
+        if (!vrui::VRUIActionRegistry::get().add(name, std::move(factory), owner)) return false;
+
+        logger::info("ImmersiveUI: API registered slot action '{}' ({})", name, owner);
+        vrui::VRMenuManager::get().queueSlotActionRebind();
+        return true;
+    }
+
+    bool ActionsInterface::UnregisterAction(const char* owner, const char* name) noexcept
+    {
+        if (!owner || !name || !vrui::VRUIActionRegistry::get().remove(name, owner)) return false;
+
+        logger::info("ImmersiveUI: API unregistered slot action '{}' ({})", name, owner);
+        vrui::VRMenuManager::get().queueSlotActionRebind();
+        return true;
+    }
+
+    bool ActionsInterface::HasAction(const char* name) noexcept
+    {
+        return name && vrui::VRUIActionRegistry::get().contains(vrui::VRUIActionRegistry::parse(name).name);
+    }
+}
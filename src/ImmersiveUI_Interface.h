@@ -0,0 +1,55 @@
+#pragma once
+
+#include "ImmersiveUI_API.h"
+
+namespace ImmersiveUI_API
+{
+    /// Implementation of IVImmersiveUIResources1/2 returned by RequestPluginAPI
+    class ResourcesInterface : public IVImmersiveUIResources2
+    {
+    public:
+        static ResourcesInterface* GetSingleton();
+
+        void GetModelCacheStats(ModelCacheStats& out) noexcept override;
+        void SetModelCacheBudget(uint32_t maxEntries, uint64_t budgetBytes) noexcept override;
+        void PinModel(const char* nifPath, bool pinned) noexcept override;
+
+        void RegisterMesh(const char* nifPath, bool critical) noexcept override;
+        void RegisterTexture(const char* ddsPath) noexcept override;
+        AssetStatus GetAssetStatus(const char* path, bool isTexture) noexcept override;
+
+    private:
+        ResourcesInterface() = default;
+    };
+
+    /// Implementation of IVImmersiveUISettings1 returned by RequestPluginAPI
+    class SettingsInterface : public IVImmersiveUISettings1
+    {
+    public:
+        static SettingsInterface* GetSingleton();
+
+        uint32_t GetProfileCount() noexcept override;
+        const char* GetProfileName(uint32_t index) noexcept override;
+        const char* GetActiveProfile() noexcept override;
+        bool SetActiveProfile(const char* name) noexcept override;
+
+    private:
+        SettingsInterface() = default;
+
+        std::string _name;  // Backs the strings returned to callers
+    };
+
+    /// Implementation of IVImmersiveUIActions1 returned by RequestPluginAPI
+    class ActionsInterface : public IVImmersiveUIActions1
+    {
+    public:
+        static ActionsInterface* GetSingleton();
+
+        bool RegisterAction(const char* owner, const char* name, SlotActionCallback callback) noexcept override;
+        bool UnregisterAction(const char* owner, const char* name) noexcept override;
+        bool HasAction(const char* name) noexcept override;
+
+    private:
+        ActionsInterface() = default;
+    };
+}
@@ -1,23 +1,31 @@
 #include "ImmersiveUI_API.h"
+#include "ImmersiveUI_Interface.h"
 #include <RE/B/BSInputDeviceManager.h>
 #include <RE/P/PlayerControls.h>
 #include <RE/U/UIMessageQueue.h>
 #include <RE/B/ButtonEvent.h>
 #include <RE/U/UserEvents.h>
-#include <RE/I/IFormFactory.h>
-#include <RE/S/Script.h>
 #include <RE/P/PlayerCharacter.h>
 #include <RE/U/UI.h>
 #include <RE/B/BGSSaveLoadManager.h>
+#include <bitset>
 
 #include "vrui/VRMenuManager.h"
 #include "vrui/VRUIPanel.h"
 #include "vrui/VRUIButton.h"
 #include "vrui/VRUIToggleButton.h"
 #include "vrui/VRUIContainer.h"
+#include "vrui/VRUISlotGrid.h"
+#include "vrui/VRUIActionRegistry.h"
+#include "vrui/VRUIConsoleCommand.h"
 #include "vrui/VRUISlider.h"
 #include "vrui/VRUISettings.h"
+#include "vrui/VRUISettingsStore.h"
 #include "vrui/VRUIMenuMCM.h"
+#include "vrui/VRUIAssetManifest.h"
+#include "vrui/VRUITextMesh.h"
+#include "vrui/VRUIProceduralMesh.h"
+#include "vrui/VRUIFontMetrics.h"
 #include "keyhandler/keyhandler.h"
 
 using namespace vrui;
@@ -66,6 +74,175 @@ static VRUIButton::PressCallback openGameMenu(const char* menuName)
     };
 }
 
+/// Add every mesh and texture the menus will need to the asset manifest, so they are
+/// validated and warmed in one pass by the time createDemoMenu runs at kPostLoadGame.
+static void buildAssetManifest()
+{
+    using Manifest = VRUIAssetManifest;
+    auto& settings = VRUISettings::get();
+    auto& manifest = Manifest::get();
+
+    manifest.add(settings.laserNifPath, Manifest::Kind::Mesh, Manifest::Priority::Critical, "laser");
+    manifest.add("textures\\test.dds", Manifest::Kind::Texture, Manifest::Priority::Critical, "laser");
+    manifest.add(settings.backgroundNifPath, Manifest::Kind::Mesh, Manifest::Priority::Critical, "background");
+    manifest.add("ImmersiveUI\\IconPlane.nif", Manifest::Kind::Mesh, Manifest::Priority::Critical, "fallback mesh");
+    manifest.add(VRUIProceduralMesh::kPoolNifPath, Manifest::Kind::Mesh, Manifest::Priority::Critical, "quad pool");
+    manifest.add(VRUITextMesh::kAtlasNifPath, Manifest::Kind::Mesh, Manifest::Priority::Critical, "font atlas");
+
+    for (int i = 0; i < settings.slots.slotCount(); ++i) {
+        auto source = "slot " + std::to_string(i + 1);
+        manifest.add(settings.slotNifPath(i), Manifest::Kind::Mesh, Manifest::Priority::Menu, source);
+        manifest.add(settings.slotTexturePath(i), Manifest::Kind::Texture, Manifest::Priority::Menu, source);
+    }
+
+    // Per-glyph fallback NIFs, only for characters the labels actually use
+    std::bitset<256> glyphs;
+    for (const auto& entry : settings.slots.entries()) {
+        for (const auto* text : { &entry.config.label, &entry.config.sublabel }) {
+            for (char c : *text) {
+                glyphs.set(static_cast<unsigned char>(std::toupper(static_cast<unsigned char>(c))));
+            }
+        }
+    }
+    for (std::size_t c = 0; c < glyphs.size(); ++c) {
+        if (glyphs.test(c) && FontMetrics::active().hasGlyph(static_cast<char>(c))) {
+            manifest.add(VRUIButton::glyphNifPath(static_cast<char>(c)), Manifest::Kind::Mesh, Manifest::Priority::Optional, "labels");
+        }
+    }
+}
+
+/// Register the slot actions ImmersiveUI provides. Runs at plugin load, before any other
+/// plugin can register through the API, so these names always keep their meaning.
+static void registerBuiltinActions()
+{
+    using Context = VRUIActionRegistry::Context;
+    auto& actions = VRUIActionRegistry::get();
+
+    auto simple = [&actions](std::string_view name, VRUIButton::PressCallback onPress) {
+        actions.add(name, [onPress = std::move(onPress)](const Context&) { return onPress; });
+    };
+
+    actions.add("NextPage", [](const Context& ctx) -> VRUIButton::PressCallback {
+        return [grid = ctx.grid](VRUIButton*) {
+            if (!grid) return;
+            grid->nextPage();
+            logger::info("ImmersiveUI: Switched to next page in container. Current: {}", grid->getCurrentPage());
+        };
+    });
+    actions.add("PrevPage", [](const Context& ctx) -> VRUIButton::PressCallback {
+        return [grid = ctx.grid](VRUIButton*) {
+            if (!grid) return;
+            grid->prevPage();
+            logger::info("ImmersiveUI: Switched to previous page in container. Current: {}", grid->getCurrentPage());
+        };
+    });
+    simple("Settings", [](VRUIButton*) {
+        VRMenuManager::get().switchToPanel("MCM_Panel");
+    });
+    simple("Close", [](VRUIButton*) {
+        VRMenuManager::get().toggleMenu();
+    });
+    simple("Wait", openGameMenu("Sleep/Wait Menu"));
+    simple("Sleep", openGameMenu("Sleep/Wait Menu"));
+    simple("Journal", openGameMenu("Journal Menu"));
+    simple("Map", openGameMenu("MapMenu"));
+    simple("Inventory", openGameMenu("InventoryMenu"));
+    simple("Magic", openGameMenu("MagicMenu"));
+    simple("TweenMenu", openGameMenu("TweenMenu"));
+    simple("Save", [](VRUIButton*) {
+        // Toggle menu closed FIRST
+        VRMenuManager::get().toggleMenu();
+
+        // Defer the input simulation to the next frame
+        auto* taskInterface = SKSE::GetTaskInterface();
+        if (taskInterface) {
+            taskInterface->AddTask([]() {
+                auto* inputMgr = RE::BSInputDeviceManager::GetSingleton();
+                auto* userEvents = RE::UserEvents::GetSingleton();
+                if (inputMgr && userEvents) {
+                    // F5 scancode is 0x3F. We simulate a quick tap.
+                    auto* down = RE::ButtonEvent::Create(RE::INPUT_DEVICE::kKeyboard, userEvents->quicksave, 0x3F, 1.0f, 0.0f);
+                    if (down) {
+                        RE::InputEvent* downPtr = down;
+                        inputMgr->SendEvent(&downPtr);
+                    }
+                    
+                    auto* up = RE::ButtonEvent::Create(RE::INPUT_DEVICE::kKeyboard, userEvents->quicksave, 0x3F, 0.0f, 0.1f);
+                    if (up) {
+                        RE::InputEvent* upPtr = up;
+                        inputMgr->SendEvent(&upPtr);
+                    }
+                    
+                    RE::DebugNotification("ImmersiveUI: QuickSaving...");
+                }
+            });
+        }
+    });
+    actions.add("Profile", [](const Context& ctx) -> VRUIButton::PressCallback {
+        return [profile = std::string(ctx.argument)](VRUIButton*) {
+            if (VRMenuManager::get().setProfile(profile)) {
+                RE::DebugNotification(("ImmersiveUI: Profile " + (profile.empty() ? std::string("(none)") : profile)).c_str());
+            }
+        };
+    });
+    simple("NextProfile", [](VRUIButton*) {
+        VRMenuManager::get().nextProfile();
+    });
+
+    // Command names checked and script forms made once, when the slot is bound; "a; b" runs both
+    auto console = [](const Context& ctx) -> VRUIButton::PressCallback {
+        auto command = VRUIConsoleCommand::get(ctx.argument);
+        if (!command->valid()) {
+            logger::warn("ImmersiveUI: Slot {} console command '{}' will not run: {}",
+                ctx.slotIndex + 1, command->text(), command->error());
+            return [command](VRUIButton*) {
+                RE::DebugNotification(("ImmersiveUI: Console command failed: " + command->error()).c_str());
+            };
+        }
+        return [command](VRUIButton*) {
+            VRMenuManager::get().toggleMenu();
+            auto failed = command->run(RE::PlayerCharacter::GetSingleton());
+            if (!failed.empty()) {
+                RE::DebugNotification(("ImmersiveUI: Console command failed: " + std::string(failed)).c_str());
+            }
+        };
+    };
+    actions.add("Console", console);
+    actions.add("Cmd", console);
+}
+
+/// Button for slot `i` (0-based) with its action bound; called by the grid when the slot's page is first shown
+static std::shared_ptr<VRUIWidget> createSlotButton(VRUISlotGrid* grid, int i)
+{
+    const auto& settings = VRUISettingsStore::get().frame();
+    const auto& slot = settings.slots.get(i);
+    const std::string& action = slot.action;
+
+    // Auto-generate NIF path: immersiveUI\slot01.nif, slot02.nif, ...
+    // If the user specified a custom NIF in sSlotXXNif, use that instead.
+    std::string nifPath = settings.slotNifPath(i);
+
+    std::string texturePath = settings.slotTexturePath(i);
+
+    auto btn = std::make_shared<VRUIButton>(action, nifPath, texturePath, 2.0f, 2.0f);
+    btn->setSlotIndex(i);
+    btn->setLabels(slot.label, slot.sublabel);
+
+    // Handler resolved once, here; pressing calls it directly
+    auto onPress = VRUIActionRegistry::get().bind(action, i, grid);
+    if (!onPress) {
+        // Unknown action (Catch-all)
+        onPress = [action](VRUIButton*) {
+            if (action != "None" && !action.empty()) {
+                RE::DebugNotification(("ImmersiveUI: Action: " + action).c_str());
+            }
+        };
+    }
+    btn->setOnPressHandler(std::move(onPress));
+
+    return btn;
+}
+
 static void createDemoMenu()
 {
     if (g_demoMenuCreated) {
@@ -88,134 +265,14 @@ static void createDemoMenu()
     });
 
     // --- Create Grid ---
-    // The grid will hold all 36 buttons, but VRMenuManager will manage visibility per page.
-    auto grid = std::make_shared<VRUIContainer>("Grid3x3", ContainerLayout::Grid, VRUISettings::get().buttonSpacing);
-    grid->setPageSize(9); // Enable automatic pagination
-
-    // Read 36 slots from INI
-    for (int i = 0; i < 36; ++i) {
-        auto& settings = VRUISettings::get();
-        std::string action = settings.slotActions[i];
-        
-        // Auto-generate NIF path: meshes\slot01.nif ... slot36.nif
-        // If the user specified a custom NIF in sSlotXXNif, use that instead.
-        std::string nifPath = settings.slotNifs[i];
-        if (nifPath.empty()) {
-            char buf[64];
-            sprintf_s(buf, "immersiveUI\\slot%02d.nif", i + 1);
-            nifPath = buf;
-        }
-
-        std::string texturePath = settings.slotTextures[i];
-        if (texturePath.empty()) {
-             texturePath = "textures\\test.dds";
-        }
-        
-        auto btn = std::make_shared<VRUIButton>(action, nifPath, texturePath, 2.0f, 2.0f);
-        btn->setSlotIndex(i);
-        btn->setLabel(settings.slotLabels[i]);
-        btn->setSublabel(settings.slotSublabels[i]);
-
-        // Bind functions based on string
-        if (action == "NextPage" || action == "nextpage") {
-            btn->setOnPressHandler([grid](VRUIButton*) {
-                grid->nextPage();
-                logger::info("ImmersiveUI: Switched to next page in container. Current: {}", grid->getCurrentPage());
-            });
-        }
-        else if (action == "PrevPage" || action == "prevpage") {
-            btn->setOnPressHandler([grid](VRUIButton*) {
-                grid->prevPage();
-                logger::info("ImmersiveUI: Switched to previous page in container. Current: {}", grid->getCurrentPage());
-            });
-        }
-        else if (action == "Settings" || action == "settings") {
-            btn->setOnPressHandler([](VRUIButton*) {
-                VRMenuManager::get().switchToPanel("MCM_Panel");
-            });
-        }
-        else if (action == "Close" || action == "close") {
-            btn->setOnPressHandler([](VRUIButton*) {
-                VRMenuManager::get().toggleMenu();
-            });
-        } 
-        else if (action == "Wait" || action == "wait" || action == "Sleep" || action == "sleep") {
-            btn->setOnPressHandler(openGameMenu("Sleep/Wait Menu"));
-        }
-        else if (action == "Journal" || action == "journal") {
-            btn->setOnPressHandler(openGameMenu("Journal Menu"));
-        }
-        else if (action == "Map" || action == "map") {
-            btn->setOnPressHandler(openGameMenu("MapMenu"));
-        }
-        else if (action == "Inventory" || action == "inventory") {
-            btn->setOnPressHandler(openGameMenu("InventoryMenu"));
-        }
-        else if (action == "Magic" || action == "magic") {
-            btn->setOnPressHandler(openGameMenu("MagicMenu"));
-        }
-        else if (action == "TweenMenu" || action == "tweenmenu") {
-            btn->setOnPressHandler(openGameMenu("TweenMenu"));
-        }
-        else if (action == "Save" || action == "save") {
-            btn->setOnPressHandler([](VRUIButton*) {
-                // Toggle menu closed FIRST
-                VRMenuManager::get().toggleMenu();
+    // One page of 9 slots at a time; as many pages as the last configured slot needs.
+    const auto& settings = VRUISettings::get();
+    auto grid = std::make_shared<VRUISlotGrid>("Grid3x3", VRUISlotTable::kSlotsPerPage, settings.buttonSpacing);
 
-                // Defer the input simulation to the next frame
-                auto* taskInterface = SKSE::GetTaskInterface();
-                if (taskInterface) {
-                    taskInterface->AddTask([]() {
-                        auto* inputMgr = RE::BSInputDeviceManager::GetSingleton();
-                        auto* userEvents = RE::UserEvents::GetSingleton();
-                        if (inputMgr && userEvents) {
-                            // F5 scancode is 0x3F. We simulate a quick tap.
-                            auto* down = RE::ButtonEvent::Create(RE::INPUT_DEVICE::kKeyboard, userEvents->quicksave, 0x3F, 1.0f, 0.0f);
-                            if (down) {
-                                RE::InputEvent* downPtr = down;
-                                inputMgr->SendEvent(&downPtr);
-                            }
-                            
-                            auto* up = RE::ButtonEvent::Create(RE::INPUT_DEVICE::kKeyboard, userEvents->quicksave, 0x3F, 0.0f, 0.1f);
-                            if (up) {
-                                RE::InputEvent* upPtr = up;
-                                inputMgr->SendEvent(&upPtr);
-                            }
-                            
-                            RE::DebugNotification("ImmersiveUI: QuickSaving...");
-                        }
-                    });
-                }
-            });
-        }
-        else if (action.starts_with("Console:") || action.starts_with("console:") || 
-                 action.starts_with("Cmd:") || action.starts_with("cmd:")) {
-            size_t colonPos = action.find(':');
-            std::string cmd = action.substr(colonPos + 1);
-            
-            btn->setOnPressHandler([cmd](VRUIButton*) {
-                VRMenuManager::get().toggleMenu();
-                
-                // Create a temporary script to execute the command via FormFactory
-                auto* script = RE::IFormFactory::Create<RE::Script>();
-                if (script) {
-                    script->SetCommand(cmd);
-                    (void)script->CompileAndRun(RE::PlayerCharacter::GetSingleton());
-                    logger::info("ImmersiveUI: Executed console command: '{}'", cmd);
-                }
-            });
-        }
-        else {
-            // Unknown action (Catch-all)
-            btn->setOnPressHandler([action](VRUIButton*) {
-                if (action != "None" && !action.empty()) {
-                    RE::DebugNotification(("ImmersiveUI: Action: " + action).c_str());
-                }
-            });
-        }
-
-        grid->addElement(btn);
-    }
+    // Pages are built the first time they are shown; memory follows the pages opened,
+    // not the number configured
+    grid->setFactory([grid = grid.get()](int slot) { return createSlotButton(grid, slot); });
+    grid->setPageCount(settings.slots.pageCount());
 
     // Assemble panel
     panel->addElement(grid);
@@ -225,7 +282,8 @@ static void createDemoMenu()
     manager.registerPanel(mcmPanel);
     g_demoMenuCreated = true;
 
-    logger::info("ImmersiveUI: Menu created with 36 slots (4 pages of 9).");
+    logger::info("ImmersiveUI: Menu created with {} configured slots ({} pages of {}).",
+        settings.slots.configuredCount(), grid->getTotalPages(), VRUISlotTable::kSlotsPerPage);
     RE::DebugNotification("ImmersiveUI: Menu Ready! Press F8 or hold LEFT grip.");
 
     // Do not auto-open menu here, because the player might still be in a loading screen
@@ -307,7 +365,7 @@ public:
 
                 if (isVRController) {
                     // Hand mappings explicitly tied to Settings
-                    auto& settings = VRUISettings::get();
+                    const auto& settings = VRUISettingsStore::get().frame();
                     bool isMenuHand = settings.useLeftHandAsMenu ? isLeftHand : isRightHand;
                     bool isDominantHand = settings.useLeftHandAsMenu ? isRightHand : isLeftHand;
                     
@@ -351,6 +409,11 @@ static void SKSEMessageHandler(SKSE::MessagingInterface::Message* message)
         VRMenuManager::get().initialize();
         VRFrameUpdater::Register();
 
+        // Validate every menu asset once and warm the caches (in the background if async
+        // loading is enabled; buttons swap meshes in as they arrive)
+        buildAssetManifest();
+        VRUIAssetManifest::get().run();
+
         // Keyboard handler for F8 toggle + G grip simulation
         KeyHandler::RegisterSink();
         {
@@ -415,6 +478,7 @@ extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* a_s
     }
 
     g_messaging->RegisterListener("SKSE", SKSEMessageHandler);
+    registerBuiltinActions();
     logger::info("ImmersiveUI: Plugin loaded successfully!");
 
     return true;
@@ -422,8 +486,20 @@ extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* a_s
 
 // Export API for other mods
 extern "C" DLLEXPORT void* RequestPluginAPI(
-    [[maybe_unused]] ImmersiveUI_API::InterfaceVersion version)
+    ImmersiveUI_API::InterfaceVersion version)
 {
     logger::info("ImmersiveUI: API requested (v{})", static_cast<int>(version));
-    return nullptr;
+
+    switch (version) {
+    case ImmersiveUI_API::InterfaceVersion::Resources1:
+        return static_cast<ImmersiveUI_API::IVImmersiveUIResources1*>(ImmersiveUI_API::ResourcesInterface::GetSingleton());
+    case ImmersiveUI_API::InterfaceVersion::Resources2:
+        return static_cast<ImmersiveUI_API::IVImmersiveUIResources2*>(ImmersiveUI_API::ResourcesInterface::GetSingleton());
+    case ImmersiveUI_API::InterfaceVersion::Settings1:
+        return static_cast<ImmersiveUI_API::IVImmersiveUISettings1*>(ImmersiveUI_API::SettingsInterface::GetSingleton());
+    case ImmersiveUI_API::InterfaceVersion::Actions1:
+        return static_cast<ImmersiveUI_API::IVImmersiveUIActions1*>(ImmersiveUI_API::ActionsInterface::GetSingleton());
+    default:
+        return nullptr;
+    }
 }
@@ -1,7 +1,21 @@
 #include "VRMenuManager.h"
 #include "VRUISettings.h"
+#include "VRUILabelCache.h"
+#include "VRUIFontMetrics.h"
+#include "VRUIAssetLoader.h"
+#include "VRUIModelResolver.h"
+#include "VRUIModelCache.h"
+#include "VRUITextureSetRegistry.h"
+#include "VRUIProceduralMesh.h"
+#include "VRUIConfigWatcher.h"
+#include "VRUISettingsWriter.h"
+#include "VRUISettingsStore.h"
+#include "VRUISettingsProfiles.h"
+#include "VRUISlotGrid.h"
+#include "VRUISlider.h"
 #include <Windows.h>
 #include <cmath>
+#include <utility>
 #include <RE/B/BSVisit.h>
 #include <RE/B/BSLightingShaderProperty.h>
 #include <RE/B/BSLightingShaderMaterialBase.h>
@@ -33,17 +47,36 @@ namespace vrui
         std::string iniPath = VRUISettings::getDefaultIniPath();
         settings.load(iniPath);
 
+        // Profiles are resolved once here; switching later needs no file access
+        auto& profiles = VRUISettingsProfiles::get();
+        profiles.load(VRUISettingsProfiles::directoryFor(iniPath), settings);
+        if (!profiles.iniProfile().empty()) {
+            if (const auto* profile = profiles.find(profiles.iniProfile())) {
+                settings = *profile;
+                logger::info("ImmersiveUI: Using settings profile '{}'", settings.activeProfile);
+            } else {
+                logger::warn("ImmersiveUI: Settings profile '{}' not found in '{}'",
+                    profiles.iniProfile(), VRUISettingsProfiles::directoryFor(iniPath));
+                settings.activeProfile.clear();
+            }
+        }
+        VRUISettingsStore::get().markChanged();
+
         // Apply log level based on INI setting
         if (settings.verboseLogging) {
-            spdlog::set_level(spdlog::level::trace);
-            logger::info("ImmersiveUI: Verbose logging ENABLED (trace level)");
+            applyLogLevel();
+        }
+
+        // Later edits to the INI are parsed on the watcher thread and applied in onFrameUpdate
+        if (settings.watchConfigFile) {
+            VRUIConfigWatcher::get().start(iniPath);
+        }
+
+        // Per-glyph advances and kerning for labels (fixed advance if the file is absent)
+        if (FontMetrics::active().loadFile(FontMetrics::kDefaultPath)) {
+            logger::info("ImmersiveUI: Loaded font metrics from '{}' ({} glyphs)",
+                FontMetrics::kDefaultPath, FontMetrics::active().glyphs().size());
         }
-        
-        try {
-            if (std::filesystem::exists(iniPath)) {
-                _lastIniModifiedTime = std::filesystem::last_write_time(iniPath);
-            }
-        } catch (...) {}
 
         // Check for VRIK explicitly because VRIK alters which player skeleton node is safely rendered (1st person vs 3rd person)
         if (GetModuleHandleA("vrik.dll") != nullptr) {
@@ -54,46 +87,16 @@ namespace vrui
             logger::info("ImmersiveUI: VRIK not detected. We will attach UI to the 1st person skeleton.");
         }
 
-        // Initialize Laser Pointer mesh
-        _laserPointer = VRUIWidget::loadModelFromNif(settings.laserNifPath);
-        if (!_laserPointer) {
-            logger::warn("ImmersiveUI: Custom laser '{}' not found, falling back to IconPlane.", settings.laserNifPath);
-            _laserPointer = VRUIWidget::loadModelFromNif("ImmersiveUI\\IconPlane.nif");
+        // Bounded NIF cache; meshes every menu needs are pinned so they are never evicted
+        auto& modelCache = VRUIModelCache::get();
+        applyCacheBudget();
+        for (const std::string& path : { settings.laserNifPath, settings.backgroundNifPath,
+                 std::string("ImmersiveUI\\IconPlane.nif"),
+                 std::string(VRUITextMesh::kAtlasNifPath), std::string(VRUIProceduralMesh::kPoolNifPath) }) {
+            modelCache.pin(path);
         }
 
-        if (_laserPointer) {
-            // Uncull
-            RE::BSVisit::TraverseScenegraphGeometries(_laserPointer.get(), [&](RE::BSGeometry* a_geometry) -> RE::BSVisit::BSVisitControl {
-                a_geometry->SetAppCulled(false);
-                return RE::BSVisit::BSVisitControl::kContinue;
-            });
-            _laserPointer->SetAppCulled(false);
-
-            _laserPointer->local.scale = 0.0f; // Hidden by default
-
-            // Apply texture to visible
-            auto* textureSet = RE::BSShaderTextureSet::Create();
-            if (textureSet) {
-                textureSet->SetTexturePath(RE::BSTextureSet::Texture::kDiffuse, "textures\\test.dds"); // Just need any visible texture
-                RE::BSVisit::TraverseScenegraphGeometries(_laserPointer.get(), [&](RE::BSGeometry* geom) -> RE::BSVisit::BSVisitControl {
-                    if (geom) {
-                        auto* shaderProp = geom->lightingShaderProp_cast();
-                        if (shaderProp && shaderProp->GetBaseMaterial()) {
-                            auto* material = static_cast<RE::BSLightingShaderMaterialBase*>(shaderProp->GetBaseMaterial());
-                            if (material) {
-                                RE::NiPointer<RE::BSTextureSet> texPtr(textureSet);
-                                material->SetTextureSet(texPtr);
-                            }
-                        }
-                    }
-                    return RE::BSVisit::BSVisitControl::kContinue;
-                });
-            }
-
-            logger::info("ImmersiveUI: Laser pointer mesh loaded successfully.");
-        } else {
-            logger::warn("ImmersiveUI: Failed to load laser pointer mesh. Laser will not be drawn.");
-        }
+        loadLaserPointer();
 
         _initialized = true;
         logger::info("ImmersiveUI: VRMenuManager initialized");
@@ -103,6 +106,26 @@ namespace vrui
     {
         if (!_initialized) return;
 
+        // 0. Settings: take an INI change the watcher thread parsed, publish this frame's
+        //    snapshot, then rebuild only what the changes since last frame invalidated
+        auto& watcher = VRUIConfigWatcher::get();
+        if (auto snapshot = watcher.poll()) {
+            logger::info("ImmersiveUI: INI file modification detected, applying settings...");
+            applyIniReload(std::move(*snapshot));
+        }
+        VRUISettingsStore::get().publish();
+        if (_pendingChanges != SettingsInvalidation::None) {
+            applySettingsChanges(std::exchange(_pendingChanges, SettingsInvalidation::None));
+        }
+        if (std::exchange(_rebindSlotActions, false)) {
+            rebindSlotActions();
+        }
+        const auto& settings = VRUISettingsStore::get().frame();
+
+        // Swap in meshes the background loader finished (bounded main-thread work)
+        VRUIAssetLoader::get().pump(settings.assetSwapBudgetMs);
+        VRUISettingsWriter::get().pump();
+
         // 1. Check activation input (grip hold)
         processActivationInput(deltaTime);
 
@@ -115,25 +138,13 @@ namespace vrui
             processTriggerInput();
         }
 
-        // 3. INI reloading (Check when Journal Menu closes)
-        auto* ui = RE::UI::GetSingleton();
-        if (ui) {
-            bool isJournalOpen = ui->IsMenuOpen("Journal Menu");
-            // If the Journal was open last frame, and is now closed
-            if (_wasJournalMenuOpen && !isJournalOpen) {
-                std::string iniPath = VRUISettings::getDefaultIniPath();
-                try {
-                    if (std::filesystem::exists(iniPath)) {
-                        auto newTime = std::filesystem::last_write_time(iniPath);
-                        if (newTime != _lastIniModifiedTime) {
-                            _lastIniModifiedTime = newTime;
-                            logger::info("ImmersiveUI: INI file modification detected (after closing Pause menu), reloading settings...");
-                            VRUISettings::get().load(iniPath);
-                        }
-                    }
-                } catch (...) {}
+        // 3. INI watching follows bWatchConfigFile
+        if (settings.watchConfigFile != watcher.isRunning()) {
+            if (watcher.isRunning()) {
+                watcher.stop();
+            } else {
+                watcher.start(VRUISettings::getDefaultIniPath());
             }
-            _wasJournalMenuOpen = isJournalOpen;
         }
 
         // ALWAYS update panels so fade animations and hand tracking finish
@@ -189,7 +200,7 @@ namespace vrui
                         settings.menuOffsetZ
                     });
                 }
-                targetPanel->recalculateLayout(); // Layout first, THEN show (so show() can apply centering)
+                targetPanel->refreshLayout(); // Layout first (if stale), THEN show (so show() can apply centering)
                 targetPanel->show();
             }
             
@@ -233,6 +244,188 @@ namespace vrui
             settings.buttonSpacing, settings.menuScale);
     }
 
+    void VRMenuManager::applySettingsSnapshot(VRUISettings snapshot)
+    {
+        auto& settings = VRUISettings::get();
+        VRUISettings previous = std::move(settings);
+        settings = std::move(snapshot);
+
+        queueSettingsChanges(diffSettings(previous, settings));
+    }
+
+    void VRMenuManager::applyIniReload(VRUISettings ini)
+    {
+        auto& profiles = VRUISettingsProfiles::get();
+
+        // An edited sProfile selects that profile; otherwise the one switched to at runtime stays
+        std::string active = ini.activeProfile != profiles.iniProfile() ? ini.activeProfile : VRUISettings::get().activeProfile;
+        profiles.rebase(ini);
+
+        const auto* resolved = profiles.find(active);
+        if (!resolved) {
+            logger::warn("ImmersiveUI: Settings profile '{}' not found, using the INI alone", active);
+            resolved = profiles.find("");
+        }
+        applySettingsSnapshot(*resolved);
+    }
+
+    bool VRMenuManager::setProfile(std::string_view name)
+    {
+        const auto* profile = VRUISettingsProfiles::get().find(name);
+        if (!profile) {
+            logger::warn("ImmersiveUI: No settings profile named '{}'", name);
+            return false;
+        }
+
+        applySettingsSnapshot(*profile);
+        logger::info("ImmersiveUI: Switched to settings profile '{}'", name.empty() ? std::string_view("(none)") : name);
+        return true;
+    }
+
+    void VRMenuManager::nextProfile()
+    {
+        setProfile(VRUISettingsProfiles::get().next(VRUISettings::get().activeProfile));
+    }
+
+    void VRMenuManager::rebindSlotActions()
+    {
+        for (auto& panel : _panels) {
+            if (!panel) continue;
+            auto* slotGrid = dynamic_cast<VRUISlotGrid*>(panel->findWidgetByName("Grid3x3"));
+            if (!slotGrid) continue;
+
+            clearHover();
+            slotGrid->releaseHiddenPages();
+            slotGrid->rebuildCurrentPage();
+        }
+    }
+
+    void VRMenuManager::clearHover()
+    {
+        if (_hoveredWidget) {
+            _hoveredWidget->onRayExit();
+            if (_triggerPressed) {
+                _hoveredWidget->onTriggerRelease();
+            }
+            _hoveredWidget = nullptr;
+        }
+        _triggerPressed = false;
+    }
+
+    void VRMenuManager::queueSettingsChanges(SettingsInvalidation changed)
+    {
+        _pendingChanges |= changed;
+        VRUISettingsStore::get().markChanged();
+    }
+
+    void VRMenuManager::applySettingsChanges(SettingsInvalidation changed)
+    {
+        using Inv = SettingsInvalidation;
+        if (changed == Inv::None || changed == Inv::PerFrame) {
+            logger::info("ImmersiveUI: Settings changed, nothing to rebuild");
+            return;
+        }
+
+        auto& settings = VRUISettings::get();
+
+        if (any(changed, Inv::Logging)) applyLogLevel();
+        if (any(changed, Inv::Assets)) applyCacheBudget();
+
+        if (any(changed, Inv::Meshes) && settings.laserNifPath != _laserNifPath) {
+            auto& modelCache = VRUIModelCache::get();
+            modelCache.pin(_laserNifPath, false);
+            modelCache.pin(settings.laserNifPath);
+            loadLaserPointer();
+        }
+
+        std::vector<VRUIButton*> buttons;
+        std::size_t reloaded = 0;
+        for (auto& panel : _panels) {
+            if (!panel) continue;
+
+            // Pages not on screen are dropped and built from the new slots when next shown
+            auto* slotGrid = dynamic_cast<VRUISlotGrid*>(panel->findWidgetByName("Grid3x3"));
+            if (slotGrid && any(changed, Inv::Slots | Inv::Meshes)) {
+                clearHover();  // The hovered button may be on a page about to be destroyed
+                slotGrid->setPageCount(settings.slots.pageCount());
+                slotGrid->releaseHiddenPages();
+            }
+            bool actionsChanged = false;
+
+            if (any(changed, Inv::Transform)) {
+                // Rotation and scale are read from settings every frame; only the offset is cached
+                panel->setOffset({ settings.menuOffsetX, settings.menuOffsetY, settings.menuOffsetZ });
+            }
+            if (any(changed, Inv::Meshes)) {
+                panel->refreshBackground();
+            }
+
+            buttons.clear();
+            panel->collectButtons(buttons);
+            for (auto* button : buttons) {
+                int slot = button->getSlotIndex();
+                bool isSlot = slot >= 0;
+                const auto& slotConfig = settings.slots.get(slot);
+
+                if (any(changed, Inv::Meshes) && isSlot &&
+                    !button->visualsMatch(settings.slotNifPath(slot), settings.slotTexturePath(slot))) {
+                    button->reloadVisuals(settings.slotNifPath(slot), settings.slotTexturePath(slot));
+                    reloaded++;
+                } else if (any(changed, Inv::MeshTransform)) {
+                    button->applyMeshTransform();
+                }
+
+                if (any(changed, Inv::Slots) && isSlot &&
+                    (button->getLabel() != slotConfig.label || button->getSublabel() != slotConfig.sublabel)) {
+                    button->setLabels(slotConfig.label, slotConfig.sublabel);
+                } else if (any(changed, Inv::Labels)) {
+                    button->refreshLabel();
+                }
+
+                // Buttons are named after their action; handlers are bound when the page is built
+                if (any(changed, Inv::Slots) && isSlot && button->getName() != slotConfig.action) {
+                    actionsChanged = true;
+                }
+            }
+
+            if (any(changed, Inv::MeshTransform)) {
+                std::vector<VRUISlider*> sliders;
+                panel->collectWidgets(sliders);
+                for (auto* slider : sliders) {
+                    slider->applyMeshTransform();
+                }
+            }
+
+            if (slotGrid && actionsChanged) {
+                clearHover();
+                slotGrid->rebuildCurrentPage();
+                logger::info("ImmersiveUI: Slot actions changed, rebuilt page {}", slotGrid->getCurrentPage() + 1);
+            }
+        }
+
+        if (any(changed, Inv::Layout)) {
+            refreshActivePanels();
+        }
+
+        logger::info("ImmersiveUI: Applied settings changes (flags {:#x}, {} button meshes reloaded)",
+            static_cast<uint16_t>(changed), reloaded);
+    }
+
+    void VRMenuManager::applyLogLevel()
+    {
+        auto& settings = VRUISettings::get();
+        spdlog::set_level(settings.verboseLogging ? spdlog::level::trace : spdlog::level::info);
+        logger::info("ImmersiveUI: Verbose logging {}", settings.verboseLogging ? "ENABLED (trace level)" : "disabled");
+    }
+
+    void VRMenuManager::applyCacheBudget()
+    {
+        auto& settings = VRUISettings::get();
+        VRUIModelCache::get().setBudget(
+            settings.modelCacheMaxEntries > 0 ? static_cast<std::size_t>(settings.modelCacheMaxEntries) : 0,
+            settings.modelCacheBudgetMB > 0.0f ? static_cast<std::size_t>(settings.modelCacheBudgetMB * 1024.0f * 1024.0f) : 0);
+    }
+
     void VRMenuManager::toggleMenu()
     {
         _menuOpen = !_menuOpen;
@@ -257,19 +450,20 @@ namespace vrui
                 panel->hide();
                 panel->detachFromParent(); // Guaranteed hide from scene graph
 
-                // Clear hover state
-                if (_hoveredWidget) {
-                    _hoveredWidget->onRayExit();
-                    if (_triggerPressed) {
-                        _hoveredWidget->onTriggerRelease();
-                    }
-                    _hoveredWidget = nullptr;
-                }
-                _triggerPressed = false;
+                clearHover();
                 hideLaserPointer();
             }
         }
 
+        if (!_menuOpen) {
+            VRUILabelCache::get().logStats();
+            VRUIModelResolver::get().logStats();
+            VRUIModelCache::get().releaseUnusedMaterials();
+            VRUIModelCache::get().logStats();
+            VRUITextureSetRegistry::get().releaseUnused();
+            VRUITextureSetRegistry::get().logStats();
+        }
+
         // Haptic feedback on toggle
         triggerHaptic(false, 0.5f, 0.2f);
     }
@@ -280,7 +474,7 @@ namespace vrui
 
     void VRMenuManager::processActivationInput(float deltaTime)
     {
-        auto& settings = VRUISettings::get();
+        const auto& settings = VRUISettingsStore::get().frame();
 
         // VR input: Read controller button state from the player character
         // In Skyrim VR, controller input goes through the standard input system.
@@ -315,7 +509,7 @@ namespace vrui
         auto* dominantHand = getDominantHandNode();
         if (!dominantHand) return;
 
-        auto& settings = VRUISettings::get();
+        const auto& settings = VRUISettingsStore::get().frame();
 
         // Tick down the hover lock timer
         if (_hoverLockTimer > 0.0f) {
@@ -338,10 +532,9 @@ namespace vrui
             }
         }
 
-        RE::NiPoint3 rayOrigin = dominantHand->world.translate;
-        
         // Skyrim's forward axis for hand/weapon nodes is Z (Col 2).
         RE::NiMatrix3& rot = dominantHand->world.rotate;
+        RE::NiPoint3 rayOrigin = dominantHand->world.translate;
         RE::NiPoint3 rayDir(rot.entry[0][2], rot.entry[1][2], rot.entry[2][2]);
         
         // Find which widget the ray intersects
@@ -352,7 +545,7 @@ namespace vrui
             if (!widget || !widget->isVisible()) continue;
             
             float hitDist = 0.0f;
-            if (widget->hitTest(rayOrigin, rayDir, hitDist)) {
+            if (widget->hitTest(rayOrigin, rayDir, hitDist, settings)) {
                 if (hitDist > 0.0f && hitDist < closestDist) {
                     closestDist = hitDist;
                     touchedWidget = widget;
@@ -400,7 +593,7 @@ namespace vrui
 
     void VRMenuManager::processTriggerInput()
     {
-        auto& settings = VRUISettings::get();
+        const auto& settings = VRUISettingsStore::get().frame();
 
         // Trigger state is set by external input callback
         bool triggerNowPressed = _triggerButtonDown;
@@ -443,7 +636,7 @@ namespace vrui
 
     RE::NiNode* VRMenuManager::getMenuHandNode() const
     {
-        auto& settings = VRUISettings::get();
+        const auto& settings = VRUISettingsStore::get().frame();
         auto* player = RE::PlayerCharacter::GetSingleton();
         if (!player) return nullptr;
 
@@ -461,7 +654,7 @@ namespace vrui
 
     RE::NiNode* VRMenuManager::getDominantHandNode() const
     {
-        auto& settings = VRUISettings::get();
+        const auto& settings = VRUISettingsStore::get().frame();
         auto* player = RE::PlayerCharacter::GetSingleton();
         if (!player) return nullptr;
 
@@ -500,7 +693,7 @@ namespace vrui
         auto* openVR = RE::BSOpenVR::GetSingleton();
         if (!openVR) return;
 
-        auto& settings = VRUISettings::get();
+        const auto& settings = VRUISettingsStore::get().frame();
         
         // Map logical hand to physical controller
         bool doRightController;
@@ -594,6 +787,51 @@ namespace vrui
         _laserPointer->Update(ctx);
     }
 
+    void VRMenuManager::loadLaserPointer()
+    {
+        auto& settings = VRUISettings::get();
+        hideLaserPointer();
+        _laserNifPath = settings.laserNifPath;
+        _laserPointer = VRUIWidget::loadModelFromNif(settings.laserNifPath);
+        if (!_laserPointer) {
+            logger::warn("ImmersiveUI: Custom laser '{}' not found, falling back to IconPlane.", settings.laserNifPath);
+            _laserPointer = VRUIWidget::loadModelFromNif("ImmersiveUI\\IconPlane.nif");
+        }
+
+        if (_laserPointer) {
+            // Uncull
+            RE::BSVisit::TraverseScenegraphGeometries(_laserPointer.get(), [&](RE::BSGeometry* a_geometry) -> RE::BSVisit::BSVisitControl {
+                a_geometry->SetAppCulled(false);
+                return RE::BSVisit::BSVisitControl::kContinue;
+            });
+            _laserPointer->SetAppCulled(false);
+
+            _laserPointer->local.scale = 0.0f; // Hidden by default
+
+            // Apply texture to visible
+            auto textureSet = VRUITextureSetRegistry::get().acquire("textures\\test.dds"); // Just need any visible texture
+            if (textureSet) {
+                RE::BSVisit::TraverseScenegraphGeometries(_laserPointer.get(), [&](RE::BSGeometry* geom) -> RE::BSVisit::BSVisitControl {
+                    if (geom) {
+                        auto* shaderProp = geom->lightingShaderProp_cast();
+                        if (shaderProp && shaderProp->GetBaseMaterial()) {
+                            auto* material = static_cast<RE::BSLightingShaderMaterialBase*>(
+                                VRUIModelCache::get().makeMaterialUnique(geom, shaderProp));
+                            if (material) {
+                                VRUITextureSetRegistry::get().bind(material, textureSet);
+                            }
+                        }
+                    }
+                    return RE::BSVisit::BSVisitControl::kContinue;
+                });
+            }
+
+            logger::info("ImmersiveUI: Laser pointer mesh loaded successfully.");
+        } else {
+            logger::warn("ImmersiveUI: Failed to load laser pointer mesh. Laser will not be drawn.");
+        }
+    }
+
     void VRMenuManager::hideLaserPointer()
     {
         if (_laserPointer && _laserActive) {
@@ -2,10 +2,11 @@
 
 #include "VRUIPanel.h"
 #include "VRUISettings.h"
+#include "VRUISettingsSchema.h"
 
 #include <vector>
 #include <memory>
-#include <filesystem>
+#include <string_view>
 
 namespace vrui
 {
@@ -35,6 +36,23 @@ namespace vrui
         /// Trigger a full layout refresh on all panels (updates scale, spacing, etc)
         void refreshActivePanels();
 
+        /// The live settings were modified: publish a new snapshot at the start of the next
+        /// frame and do the work `changed` calls for then (see applySettingsChanges)
+        void queueSettingsChanges(SettingsInvalidation changed);
+
+        /// Switch to settings profile `name` ("" = ImmersiveUI.ini alone). Only what differs
+        /// from the current settings is rebuilt. Returns false if there is no such profile.
+        bool setProfile(std::string_view name);
+
+        /// Switch to the profile after the active one (wraps through "")
+        void nextProfile();
+
+        /// Slot actions were registered or removed: at the start of the next frame, rebuild
+        /// the slot page on screen and drop the hidden ones so every slot binds against the
+        /// current action registry. Deferred because the caller may be running inside a
+        /// slot's press handler, whose button the rebuild destroys.
+        void queueSlotActionRebind() { _rebindSlotActions = true; }
+
         /// Toggle menu visibility (called by activation gesture)
         void toggleMenu();
 
@@ -62,6 +80,9 @@ namespace vrui
     private:
         VRMenuManager() = default;
 
+        /// End the hover (and a held trigger). Call before destroying widgets: _hoveredWidget is a raw pointer.
+        void clearHover();
+
         // --- Input processing ---
         void processActivationInput(float deltaTime);
         void processTouchInput(float deltaTime);
@@ -72,7 +93,24 @@ namespace vrui
         RE::NiNode* getDominantHandNode() const;
         RE::NiNode* getPlayerSkeletonRoot() const;
 
+        // --- Settings ---
+        /// Replace the settings with `snapshot` and queue only what differs
+        void applySettingsSnapshot(VRUISettings snapshot);
+
+        /// ImmersiveUI.ini was reloaded: re-resolve the profiles over it and apply the active one
+        void applyIniReload(VRUISettings ini);
+
+        /// Do only the work `changed` calls for: offsets, mesh transforms, label text,
+        /// meshes whose path or UV flip changed, relayout, log level, cache budget.
+        /// Everything is reconciled against the current VRUISettings.
+        void applySettingsChanges(SettingsInvalidation changed);
+        void rebindSlotActions();
+        void applyLogLevel();
+        void applyCacheBudget();
+
         // --- Laser Pointer ---
+        /// (Re)load the laser mesh from sLaserNifPath
+        void loadLaserPointer();
         void updateLaserPointer(RE::NiNode* dominantHand, float targetDistance);
         void hideLaserPointer();
 
@@ -84,13 +122,13 @@ namespace vrui
         bool _isVRIKInstalled = false;
 
         bool _initialized = false;
+        SettingsInvalidation _pendingChanges = SettingsInvalidation::None;  // Applied at the next frame start
+        bool _rebindSlotActions = false;                                     // Likewise (queueSlotActionRebind)
         bool _menuOpen = false;
         float _gripHoldTimer = 0.0f;
         bool _gripWasHeld = false;       // Prevents re-trigger while holding
         bool _triggerPressed = false;
 
-        bool _wasJournalMenuOpen = false;
-        std::filesystem::file_time_type _lastIniModifiedTime;
 
         // External input state (set by callbacks)
         bool _gripButtonDown = false;
@@ -103,6 +141,7 @@ namespace vrui
 
         // Laser pointer mesh (dynamically scaled IconPlane.nif)
         RE::NiPointer<RE::NiNode> _laserPointer;
+        std::string _laserNifPath;  // Path the laser was loaded from
         bool _laserActive = false;
 
         // Smoothing state
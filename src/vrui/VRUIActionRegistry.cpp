@@ -0,0 +1,91 @@
+#include "VRUIActionRegistry.h"
+
+namespace vrui
+{
+    namespace
+    {
+        constexpr char toLower(char c)
+        {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+
+        bool equalsNoCase(std::string_view a, std::string_view b)
+        {
+            if (a.size() != b.size()) return false;
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                if (toLower(a[i]) != toLower(b[i])) return false;
+            }
+            return true;
+        }
+
+        std::string_view trim(std::string_view text)
+        {
+            constexpr std::string_view kSpace = " \t";
+            auto first = text.find_first_not_of(kSpace);
+            if (first == std::string_view::npos) return {};
+            return text.substr(first, text.find_last_not_of(kSpace) - first + 1);
+        }
+    }
+
+    VRUIActionRegistry& VRUIActionRegistry::get()
+    {
+        static VRUIActionRegistry instance;
+        return instance;
+    }
+
+    VRUIActionRegistry::Parsed VRUIActionRegistry::parse(std::string_view action)
+    {
+        Parsed parsed;
+        auto colon = action.find(':');
+        parsed.name = trim(action.substr(0, colon));
+        if (colon != std::string_view::npos) {
+            parsed.argument = action.substr(colon + 1);
+        }
+        return parsed;
+    }
+
+    bool VRUIActionRegistry::add(std::string_view name, Factory factory, std::string_view owner)
+    {
+        if (name.empty() || !factory) return false;
+
+        auto [it, inserted] = _actions.try_emplace(key(name));
+        if (!inserted) {
+            logger::warn("ImmersiveUI: Action '{}' from {} not registered: '{}' is already registered by {}",
+                name, owner, it->second.name, it->second.owner);
+            return false;
+        }
+
+        it->second = Entry{ std::string(name), std::string(owner), std::move(factory) };
+        logger::debug("ImmersiveUI: Registered action '{}' ({})", name, owner);
+        return true;
+    }
+
+    bool VRUIActionRegistry::remove(std::string_view name, std::string_view owner)
+    {
+        auto it = _actions.find(key(name));
+        if (it == _actions.end() || !equalsNoCase(it->second.name, name) || it->second.owner != owner) return false;
+
+        _actions.erase(it);
+        return true;
+    }
+
+    const VRUIActionRegistry::Entry* VRUIActionRegistry::find(std::string_view name) const
+    {
+        // Hash lookup, then a real comparison so a collision can never run the wrong action
+        auto it = _actions.find(key(name));
+        return it != _actions.end() && equalsNoCase(it->second.name, name) ? &it->second : nullptr;
+    }
+
+    VRUIButton::PressCallback VRUIActionRegistry::bind(std::string_view action, int slotIndex, VRUISlotGrid* grid) const
+    {
+        auto parsed = parse(action);
+        const auto* entry = find(parsed.name);
+        if (!entry) return nullptr;
+
+        Context context;
+        context.argument = parsed.argument;
+        context.slotIndex = slotIndex;
+        context.grid = grid;
+        return entry->factory(context);
+    }
+}
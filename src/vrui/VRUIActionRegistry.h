@@ -0,0 +1,86 @@
+#pragma once
+
+#include "VRUIButton.h"
+#include <CLIBUtil/string.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace vrui
+{
+    class VRUISlotGrid;
+
+    /// Slot actions by name ("Map", "NextPage", "Console:coc riverwood", ...).
+    ///
+    /// Names are keyed by a case-insensitive FNV-1a hash that matches clib_util's
+    /// const_hash / "_h" of the lowercase name, so key("NextPage") == "nextpage"_h is a
+    /// compile-time constant. An action string is split once into "Name" and the
+    /// argument after the first ':'; bind() turns it into a press handler when the
+    /// slot's button is built, so pressing never looks anything up. ImmersiveUI
+    /// registers its own actions at plugin load; other plugins add theirs through
+    /// IVImmersiveUIActions1. Main thread only.
+    class VRUIActionRegistry
+    {
+    public:
+        /// What bind() knows about the slot being built
+        struct Context
+        {
+            std::string_view argument;      // Text after "Name:" ("" without one)
+            int slotIndex = -1;
+            VRUISlotGrid* grid = nullptr;   // Paged grid holding the slot
+        };
+
+        /// Builds the press handler for one slot (may return nullptr to reject the argument)
+        using Factory = std::function<VRUIButton::PressCallback(const Context&)>;
+
+        static VRUIActionRegistry& get();
+
+        /// Case-insensitive key of an action name
+        static constexpr uint64_t key(std::string_view name)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (char c : name) {
+                hash ^= static_cast<unsigned char>((c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        /// "Name:argument" -> name and argument (name trimmed; argument as written)
+        struct Parsed
+        {
+            std::string_view name;
+            std::string_view argument;
+        };
+        static Parsed parse(std::string_view action);
+
+        /// Register `name`. Returns false if another owner already registered it.
+        bool add(std::string_view name, Factory factory, std::string_view owner = "ImmersiveUI");
+
+        /// Remove `name` if `owner` registered it
+        bool remove(std::string_view name, std::string_view owner);
+
+        bool contains(std::string_view name) const { return find(name) != nullptr; }
+
+        /// Press handler for `action` in slot `slotIndex`, or nullptr if the action is unknown
+        VRUIButton::PressCallback bind(std::string_view action, int slotIndex, VRUISlotGrid* grid) const;
+
+    private:
+        VRUIActionRegistry() = default;
+
+        struct Entry
+        {
+            std::string name;
+            std::string owner;
+            Factory factory;
+        };
+
+        const Entry* find(std::string_view name) const;
+
+        std::unordered_map<uint64_t, Entry> _actions;
+    };
+
+    static_assert(VRUIActionRegistry::key("NextPage") == clib_util::string::const_hash("nextpage"));
+}
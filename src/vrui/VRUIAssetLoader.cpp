@@ -0,0 +1,159 @@
+#include "VRUIAssetLoader.h"
+#include "VRUISettings.h"
+#include "VRUIWidget.h"
+#include "VRUIModelResolver.h"
+#include <chrono>
+#include <iterator>
+#include <thread>
+
+namespace vrui
+{
+    VRUIAssetLoader& VRUIAssetLoader::get()
+    {
+        static VRUIAssetLoader instance;
+        return instance;
+    }
+
+    RE::NiPointer<RE::NiNode> VRUIAssetLoader::createPlaceholder(const std::string& name)
+    {
+        auto node = RE::NiPointer<RE::NiNode>(RE::NiNode::Create(0));
+        if (node) {
+            node->name = name + "_Placeholder";
+        }
+        return node;
+    }
+
+    void VRUIAssetLoader::queue(const std::string& nifPath)
+    {
+        ResourceKey key(nifPath);
+        if (key.empty() || _resolved.contains(key) || VRUIWidget::isModelCached(nifPath) ||
+            VRUIModelResolver::get().isKnownMissing(nifPath)) return;
+
+        std::lock_guard lock(_mutex);
+        if (!_inFlight.insert(key).second) return;
+
+        _pending.push_back(nifPath);
+        _stats.queued++;
+        startWorkerLocked();
+    }
+
+    void VRUIAssetLoader::request(const std::string& nifPath, std::weak_ptr<void> owner, ReadyCallback onReady)
+    {
+        if (!onReady) return;
+
+        // Synchronous when disabled, already cached, or already known to be missing
+        bool missing = VRUIModelResolver::get().isKnownMissing(nifPath);
+        if (!VRUISettings::get().asyncAssetLoading || VRUIWidget::isModelCached(nifPath) || missing) {
+            onReady(missing ? nullptr : VRUIWidget::loadModelFromNif(nifPath));
+            return;
+        }
+
+        _waiters.push_back(Waiter{ nifPath, std::move(owner), std::move(onReady) });
+        queue(nifPath);
+    }
+
+    bool VRUIAssetLoader::isBusy() const
+    {
+        std::lock_guard lock(_mutex);
+        return !_inFlight.empty() || !_waiters.empty();
+    }
+
+    void VRUIAssetLoader::startWorkerLocked()
+    {
+        if (_workerRunning) return;
+        _workerRunning = true;
+
+        // The worker exits once the queue drains, so no thread outlives a loading burst
+        std::thread(&VRUIAssetLoader::workerMain, this).detach();
+    }
+
+    void VRUIAssetLoader::workerMain()
+    {
+        for (;;) {
+            std::string path;
+            {
+                std::lock_guard lock(_mutex);
+                if (_pending.empty()) {
+                    _workerRunning = false;
+                    return;
+                }
+                path = std::move(_pending.front());
+                _pending.pop_front();
+            }
+
+            // BSModelDB is the game's own (thread-safe) loader; the root is not attached anywhere yet
+            auto root = VRUIWidget::demandModel(path);
+
+            std::lock_guard lock(_mutex);
+            _completed.push_back(Completed{ std::move(path), std::move(root) });
+        }
+    }
+
+    void VRUIAssetLoader::pump(float budgetMs)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+
+        std::vector<Completed> completed;
+        {
+            std::lock_guard lock(_mutex);
+            completed.swap(_completed);
+            for (const auto& entry : completed) {
+                _inFlight.erase(ResourceKey(entry.path));
+            }
+        }
+
+        for (auto& entry : completed) {
+            bool ok = entry.root != nullptr;
+            if (ok) {
+                VRUIWidget::cacheModel(entry.path, entry.root);
+                _stats.loaded++;
+            } else {
+                _stats.failed++;
+            }
+            _resolved[ResourceKey(entry.path)] = ok;
+            _reportPending = true;
+        }
+
+        if (!_waiters.empty()) {
+            // Callbacks may request more models, so deliver from a local list
+            std::deque<Waiter> waiting;
+            waiting.swap(_waiters);
+            std::deque<Waiter> keep;
+            std::size_t delivered = 0;
+
+            while (!waiting.empty()) {
+                auto resolved = _resolved.find(ResourceKey(waiting.front().path));
+                if (resolved == _resolved.end()) {
+                    keep.push_back(std::move(waiting.front()));
+                    waiting.pop_front();
+                    continue;
+                }
+
+                float elapsedMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+                if (delivered > 0 && elapsedMs >= budgetMs) {
+                    _stats.deferred++;
+                    break;
+                }
+
+                Waiter waiter = std::move(waiting.front());
+                waiting.pop_front();
+                if (waiter.owner.expired()) continue;
+
+                waiter.onReady(resolved->second ? VRUIWidget::loadModelFromNif(waiter.path) : nullptr);
+                delivered++;
+                _stats.swapped++;
+            }
+
+            // Unfinished requests keep their order ahead of any made by the callbacks
+            keep.insert(keep.end(), std::make_move_iterator(waiting.begin()), std::make_move_iterator(waiting.end()));
+            _waiters.insert(_waiters.begin(), std::make_move_iterator(keep.begin()), std::make_move_iterator(keep.end()));
+        }
+
+        if (_reportPending && !isBusy()) {
+            _reportPending = false;
+            logger::info("ImmersiveUI: Async assets idle: {} queued, {} loaded, {} failed, {} swapped in ({} frames over budget)",
+                _stats.queued, _stats.loaded, _stats.failed, _stats.swapped, _stats.deferred);
+        }
+    }
+}
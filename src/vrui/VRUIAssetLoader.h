@@ -0,0 +1,94 @@
+#pragma once
+
+#include "VRUIResourceKey.h"
+#include <RE/Skyrim.h>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace vrui
+{
+    /// Background NIF loader.
+    ///
+    /// Paths are queued (at kDataLoaded for the known menu assets, or on demand by widgets)
+    /// and resolved with BSModelDB::Demand on a worker thread. The worker only loads and
+    /// holds the model roots; nothing touches the live scene graph off the main thread.
+    /// Finished models are handed to the NIF cache and to waiting widgets in pump(), which
+    /// runs on the main thread every frame within a time budget.
+    class VRUIAssetLoader
+    {
+    public:
+        /// Receives a clone of the loaded model (nullptr if it could not be loaded). Main thread only.
+        using ReadyCallback = std::function<void(RE::NiPointer<RE::NiNode>)>;
+
+        struct Stats
+        {
+            uint64_t queued = 0;     // Paths sent to the worker
+            uint64_t loaded = 0;     // Paths the worker resolved
+            uint64_t failed = 0;     // Paths no variant could be loaded for
+            uint64_t swapped = 0;    // Callbacks delivered by pump()
+            uint64_t deferred = 0;   // Frames pump() ran out of budget with work left
+        };
+
+        static VRUIAssetLoader& get();
+
+        /// Queue a path for background loading (no-op if cached, queued or in flight)
+        void queue(const std::string& nifPath);
+
+        /// Call `onReady` with a clone of `nifPath` once it is loaded.
+        /// If the model is already cached this calls back immediately; otherwise the path is
+        /// queued and the callback runs from pump(). `owner` ties the request to a widget:
+        /// once it expires the callback is dropped.
+        void request(const std::string& nifPath, std::weak_ptr<void> owner, ReadyCallback onReady);
+
+        /// Main thread: move finished models into the cache and deliver callbacks,
+        /// stopping once `budgetMs` has elapsed (at least one callback per call).
+        void pump(float budgetMs);
+
+        /// True while any path is queued, in flight, or waiting for delivery
+        bool isBusy() const;
+
+        /// Empty node widgets show until their model arrives
+        static RE::NiPointer<RE::NiNode> createPlaceholder(const std::string& name);
+
+        const Stats& getStats() const { return _stats; }
+
+    private:
+        VRUIAssetLoader() = default;
+
+        struct Completed
+        {
+            std::string path;
+            RE::NiPointer<RE::NiNode> root;
+        };
+
+        struct Waiter
+        {
+            std::string path;
+            std::weak_ptr<void> owner;
+            ReadyCallback onReady;
+        };
+
+        void startWorkerLocked();
+        void workerMain();
+
+        // Shared with the worker (guarded by _mutex)
+        mutable std::mutex _mutex;
+        std::deque<std::string> _pending;
+        std::vector<Completed> _completed;
+        std::unordered_set<ResourceKey, ResourceKey::Hasher> _inFlight;  // Queued or loading, not yet pumped
+        bool _workerRunning = false;
+
+        // Main thread only
+        std::deque<Waiter> _waiters;
+        std::unordered_map<ResourceKey, bool, ResourceKey::Hasher> _resolved;  // Loaded (false = failed)
+        Stats _stats;
+        bool _reportPending = false;
+    };
+}
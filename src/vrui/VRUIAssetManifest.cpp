@@ -0,0 +1,157 @@
+#include "VRUIAssetManifest.h"
+#include "VRUIAssetLoader.h"
+#include "VRUIModelResolver.h"
+#include "VRUISettings.h"
+#include "VRUITextureSetRegistry.h"
+#include "VRUIWidget.h"
+#include <RE/B/BSResourceNiBinaryStream.h>
+#include <algorithm>
+#include <chrono>
+
+namespace vrui
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        double elapsedMs(Clock::time_point start)
+        {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        constexpr std::size_t kMaxListedMissing = 10;
+    }
+
+    VRUIAssetManifest& VRUIAssetManifest::get()
+    {
+        static VRUIAssetManifest instance;
+        return instance;
+    }
+
+    std::string VRUIAssetManifest::resourcePath(std::string_view path, Kind kind)
+    {
+        return (kind == Kind::Mesh ? "meshes\\" : "textures\\") + ResourceKey::canonicalize(path);
+    }
+
+    void VRUIAssetManifest::add(std::string_view path, Kind kind, Priority priority, std::string_view source)
+    {
+        if (path.empty()) return;
+
+        ResourceKey key(path);
+        auto& index = _index[static_cast<std::size_t>(kind)];
+        auto it = index.find(key);
+        if (it != index.end() && ResourceKey::samePath(_entries[it->second].path, path)) {
+            auto& entry = _entries[it->second];
+            entry.priority = std::min(entry.priority, priority);
+            return;
+        }
+
+        if (it != index.end()) {
+            // Still validated and warmed, just not reported by getStatus()
+            logger::warn("ImmersiveUI: Asset key of '{}' collides with '{}'", path, _entries[it->second].path);
+        } else {
+            index.emplace(key, _entries.size());
+        }
+        _entries.push_back(Entry{ std::string(path), kind, priority, std::string(source) });
+
+        // Late registrations (API users after kDataLoaded) are handled on the spot
+        if (_hasRun) {
+            auto& entry = _entries.back();
+            if (validate(entry)) {
+                warm(entry);
+            } else {
+                logger::warn("ImmersiveUI: Registered {} '{}' ({}) not found",
+                    kind == Kind::Mesh ? "mesh" : "texture", entry.path, entry.source);
+            }
+        }
+    }
+
+    bool VRUIAssetManifest::validate(Entry& entry)
+    {
+        // Opens through the game's resource system, so archived files count as present
+        RE::BSResourceNiBinaryStream stream(resourcePath(entry.path, entry.kind));
+        entry.status = stream.good() ? Status::Available : Status::Missing;
+
+        if (entry.status == Status::Missing && entry.kind == Kind::Mesh) {
+            // Nothing will try BSModelDB::Demand for it again
+            VRUIModelResolver::get().recordMissing(entry.path);
+        }
+        return entry.status == Status::Available;
+    }
+
+    void VRUIAssetManifest::warm(const Entry& entry)
+    {
+        if (entry.kind == Kind::Texture) {
+            // One shared texture set per icon, created ahead of the buttons
+            VRUITextureSetRegistry::get().acquire(entry.path);
+            return;
+        }
+
+        if (VRUISettings::get().asyncAssetLoading) {
+            VRUIAssetLoader::get().queue(entry.path);
+            _report.queued++;
+        } else if (!VRUIWidget::isModelCached(entry.path) && VRUIWidget::loadModelFromNif(entry.path)) {
+            // The clone is dropped; the master stays in the model cache
+            _report.warmed++;
+        }
+    }
+
+    void VRUIAssetManifest::run()
+    {
+        _hasRun = true;
+        _report = Report{};
+
+        // 1. Validate everything in one pass
+        auto start = Clock::now();
+        std::vector<const Entry*> missing;
+        for (auto& entry : _entries) {
+            bool found = validate(entry);
+            bool mesh = entry.kind == Kind::Mesh;
+            (mesh ? _report.meshes : _report.textures)++;
+            if (found) continue;
+
+            if (entry.priority == Priority::Optional) {
+                _report.missingOptional++;
+            } else {
+                (mesh ? _report.missingMeshes : _report.missingTextures)++;
+                missing.push_back(&entry);
+            }
+        }
+        _report.validateMs = elapsedMs(start);
+
+        // 2. Warm the caches, most urgent first (the loader keeps queue order)
+        start = Clock::now();
+        std::vector<const Entry*> order;
+        order.reserve(_entries.size());
+        for (const auto& entry : _entries) {
+            if (entry.status == Status::Available) order.push_back(&entry);
+        }
+        std::stable_sort(order.begin(), order.end(), [](const Entry* a, const Entry* b) { return a->priority < b->priority; });
+        for (const auto* entry : order) {
+            warm(*entry);
+        }
+        _report.warmMs = elapsedMs(start);
+
+        // 3. One report
+        logger::info("ImmersiveUI: Asset manifest: {} meshes ({} missing), {} textures ({} missing), {} optional fallbacks missing; "
+                     "validated in {:.1f} ms, warm-up {:.1f} ms ({} loaded, {} queued for background loading)",
+            _report.meshes, _report.missingMeshes, _report.textures, _report.missingTextures, _report.missingOptional,
+            _report.validateMs, _report.warmMs, _report.warmed, _report.queued);
+
+        for (std::size_t i = 0; i < missing.size() && i < kMaxListedMissing; ++i) {
+            logger::warn("ImmersiveUI:   missing {} '{}' (needed by {})",
+                missing[i]->kind == Kind::Mesh ? "mesh" : "texture", missing[i]->path, missing[i]->source);
+        }
+        if (missing.size() > kMaxListedMissing) {
+            logger::warn("ImmersiveUI:   ... and {} more missing assets", missing.size() - kMaxListedMissing);
+        }
+    }
+
+    VRUIAssetManifest::Status VRUIAssetManifest::getStatus(std::string_view path, Kind kind) const
+    {
+        const auto& index = _index[static_cast<std::size_t>(kind)];
+        auto it = index.find(ResourceKey(path));
+        if (it == index.end() || !ResourceKey::samePath(_entries[it->second].path, path)) return Status::Unknown;
+        return _entries[it->second].status;
+    }
+}
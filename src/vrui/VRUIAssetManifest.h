@@ -0,0 +1,95 @@
+#pragma once
+
+#include "VRUIResourceKey.h"
+#include <RE/Skyrim.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace vrui
+{
+    /// Every mesh and texture the menu is going to ask for, checked once at kDataLoaded.
+    ///
+    /// Entries come from the settings (see buildAssetManifest in main.cpp) and from API
+    /// registrations. run() validates them all in one pass through the game's resource
+    /// streams (loose files and archives), records missing meshes with the resolver so they
+    /// are never probed again, warms the model cache (or queues the background loader) in
+    /// priority order and logs one report. Entries added after run() are validated and
+    /// warmed immediately. Main thread only.
+    class VRUIAssetManifest
+    {
+    public:
+        enum class Kind : uint8_t
+        {
+            Mesh,
+            Texture
+        };
+
+        /// Warm-up order; missing Optional assets are counted but not listed
+        enum class Priority : uint8_t
+        {
+            Critical,  // Needed by every menu (laser, background, pools)
+            Menu,      // Slot meshes and icons
+            Optional   // Fallbacks (per-glyph NIFs)
+        };
+
+        enum class Status : uint8_t
+        {
+            Unknown,  // Not validated yet (or not in the manifest)
+            Available,
+            Missing
+        };
+
+        struct Report
+        {
+            std::size_t meshes = 0;
+            std::size_t textures = 0;
+            std::size_t missingMeshes = 0;
+            std::size_t missingTextures = 0;
+            std::size_t missingOptional = 0;
+            std::size_t warmed = 0;   // Loaded into the model cache (synchronous warm-up)
+            std::size_t queued = 0;   // Handed to the background loader
+            double validateMs = 0.0;
+            double warmMs = 0.0;
+        };
+
+        static VRUIAssetManifest& get();
+
+        /// Add an asset (duplicates keep the more urgent priority). `source` names who needs it.
+        void add(std::string_view path, Kind kind, Priority priority, std::string_view source);
+
+        /// Validate and warm everything added so far, then log the report
+        void run();
+
+        bool hasRun() const { return _hasRun; }
+
+        Status getStatus(std::string_view path, Kind kind) const;
+
+        const Report& getReport() const { return _report; }
+
+    private:
+        VRUIAssetManifest() = default;
+
+        struct Entry
+        {
+            std::string path;  // As given (what the widgets will request)
+            Kind kind;
+            Priority priority;
+            std::string source;
+            Status status = Status::Unknown;
+        };
+
+        /// Path as the resource system sees it: "meshes\..." or "textures\..."
+        static std::string resourcePath(std::string_view path, Kind kind);
+
+        bool validate(Entry& entry);
+        void warm(const Entry& entry);
+
+        std::vector<Entry> _entries;
+        std::unordered_map<ResourceKey, std::size_t, ResourceKey::Hasher> _index[2];  // Per Kind: key -> entry
+        Report _report;
+        bool _hasRun = false;
+    };
+}
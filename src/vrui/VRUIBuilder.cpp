@@ -0,0 +1,235 @@
+#include "VRUIBuilder.h"
+#include <cmath>
+#include <utility>
+
+namespace vrui
+{
+    VRUIBuilder::VRUIBuilder(std::shared_ptr<VRUIContainer> root)
+        : _root(std::move(root))
+    {
+    }
+
+    VRUIBuilder::~VRUIBuilder() = default;
+
+    void VRUIBuilder::begin()
+    {
+        if (!_scopes.empty()) {
+            logger::warn("ImmersiveUI: VRUIBuilder::begin() called twice without end(), discarding open scopes");
+            _scopes.clear();
+        }
+
+        ++_generation;
+        _changed = false;
+        _scopes.push_back(Scope{ _root.get(), &_rootRetained, {}, false });
+    }
+
+    bool VRUIBuilder::end()
+    {
+        if (_scopes.size() > 1) {
+            logger::warn("ImmersiveUI: VRUIBuilder::end() with {} unclosed row(s)", _scopes.size() - 1);
+        }
+        while (!_scopes.empty()) {
+            closeScope(_scopes.back());
+            _scopes.pop_back();
+        }
+
+        // One layout pass for the whole tree, and only if its structure changed
+        if (_changed && _root) {
+            _root->recalculateLayout();
+        }
+        return _changed;
+    }
+
+    template <class Factory>
+    VRUIBuilder::Entry& VRUIBuilder::touch(const std::string& id, WidgetKind kind, Factory&& create)
+    {
+        auto& scope = _scopes.back();
+        auto& entries = scope.retained->entries;
+
+        auto it = entries.find(id);
+        if (it != entries.end() && it->second.kind != kind) {
+            // Same id, different widget type: replace it (old widget is detached in closeScope)
+            entries.erase(it);
+            it = entries.end();
+        }
+
+        if (it == entries.end()) {
+            Entry entry;
+            entry.kind = kind;
+            entry.input = std::make_shared<EntryInput>();
+            entry.widget = create(entry.input);
+            if (kind == WidgetKind::Row) {
+                entry.children = std::make_unique<Retained>();
+            }
+            it = entries.emplace(id, std::move(entry)).first;
+            scope.structureChanged = true;
+        }
+
+        auto& entry = it->second;
+        if (entry.generation == _generation) {
+            logger::warn("ImmersiveUI: VRUIBuilder id '{}' used twice in the same container", id);
+            return entry;
+        }
+        entry.generation = _generation;
+
+        // Any deviation from last pass's order means the container must be re-sequenced
+        size_t index = scope.order.size();
+        const auto& previous = scope.retained->order;
+        if (index >= previous.size() || previous[index] != id) {
+            scope.structureChanged = true;
+        }
+        scope.order.push_back(id);
+
+        return entry;
+    }
+
+    void VRUIBuilder::closeScope(Scope& scope)
+    {
+        auto& retained = *scope.retained;
+        if (scope.order.size() != retained.order.size()) {
+            scope.structureChanged = true;
+        }
+
+        // Forget widgets that were not described this pass
+        for (auto it = retained.entries.begin(); it != retained.entries.end();) {
+            if (it->second.generation != _generation) {
+                it = retained.entries.erase(it);
+                scope.structureChanged = true;
+            } else {
+                ++it;
+            }
+        }
+
+        if (!scope.structureChanged || !scope.container) return;
+
+        std::vector<std::shared_ptr<VRUIWidget>> elements;
+        elements.reserve(scope.order.size());
+        for (const auto& id : scope.order) {
+            elements.push_back(retained.entries[id].widget);
+        }
+
+        scope.container->setElements(elements, false);
+        retained.order = std::move(scope.order);
+        _changed = true;
+    }
+
+    bool VRUIBuilder::button(const std::string& id, const std::string& label, const ButtonStyle& style)
+    {
+        auto& entry = touch(id, WidgetKind::Button, [&](const std::shared_ptr<EntryInput>& input) {
+            auto btn = std::make_shared<VRUIButton>(id, style.nifPath, style.texturePath, style.width, style.height);
+            std::weak_ptr<EntryInput> weakInput = input;
+            btn->setOnPressHandler([weakInput](VRUIButton*) {
+                if (auto in = weakInput.lock()) in->pressed = true;
+            });
+            return btn;
+        });
+
+        auto* btn = static_cast<VRUIButton*>(entry.widget.get());
+        if (btn->getLabel() != label) {
+            btn->setLabel(label);
+        }
+
+        return std::exchange(entry.input->pressed, false);
+    }
+
+    bool VRUIBuilder::takePress(const std::string& id)
+    {
+        if (_scopes.empty()) return false;
+
+        auto& entries = _scopes.back().retained->entries;
+        auto it = entries.find(id);
+        return it != entries.end() && it->second.kind == WidgetKind::Button &&
+               std::exchange(it->second.input->pressed, false);
+    }
+
+    bool VRUIBuilder::toggle(const std::string& id, const std::string& label, bool* value, const ButtonStyle& style)
+    {
+        auto& entry = touch(id, WidgetKind::Toggle, [&](const std::shared_ptr<EntryInput>& input) {
+            auto btn = std::make_shared<VRUIToggleButton>(id, value ? *value : false, style.nifPath, style.width, style.height);
+            std::weak_ptr<EntryInput> weakInput = input;
+            btn->setOnToggleHandler([weakInput](VRUIToggleButton*, bool) {
+                if (auto in = weakInput.lock()) in->toggled = true;
+            });
+            return btn;
+        });
+
+        auto* btn = static_cast<VRUIToggleButton*>(entry.widget.get());
+        if (btn->getLabel() != label) {
+            btn->setLabel(label);
+        }
+
+        if (std::exchange(entry.input->toggled, false)) {
+            if (value) *value = btn->isToggled();
+            return true;
+        }
+        if (value && btn->isToggled() != *value) {
+            btn->setToggled(*value);
+        }
+        return false;
+    }
+
+    bool VRUIBuilder::slider(const std::string& id, float* value, float minValue, float maxValue,
+                             float width, float height)
+    {
+        auto& entry = touch(id, WidgetKind::Slider, [&](const std::shared_ptr<EntryInput>& input) {
+            auto s = std::make_shared<VRUISlider>(id, minValue, maxValue, value ? *value : minValue, width, height);
+            std::weak_ptr<EntryInput> weakInput = input;
+            s->setOnValueChanged([weakInput](float) {
+                if (auto in = weakInput.lock()) in->valueChanged = true;
+            });
+            return s;
+        });
+
+        auto* s = static_cast<VRUISlider*>(entry.widget.get());
+        if (std::exchange(entry.input->valueChanged, false)) {
+            if (value) *value = s->getValue();
+            return true;
+        }
+        if (value && std::abs(s->getValue() - *value) > 0.0001f) {
+            s->setValue(*value, false);
+        }
+        return false;
+    }
+
+    void VRUIBuilder::spacer(const std::string& id, float width, float height)
+    {
+        touch(id, WidgetKind::Spacer, [&](const std::shared_ptr<EntryInput>&) {
+            return std::make_shared<VRUIWidget>(id, width, height);
+        });
+    }
+
+    void VRUIBuilder::beginRow(const std::string& id, ContainerLayout layout, float spacing)
+    {
+        auto& entry = touch(id, WidgetKind::Row, [&](const std::shared_ptr<EntryInput>&) {
+            return std::make_shared<VRUIContainer>(id, layout, spacing);
+        });
+
+        auto* row = static_cast<VRUIContainer*>(entry.widget.get());
+        _scopes.push_back(Scope{ row, entry.children.get(), {}, false });
+    }
+
+    void VRUIBuilder::endRow()
+    {
+        if (_scopes.size() <= 1) {
+            logger::warn("ImmersiveUI: VRUIBuilder::endRow() without matching beginRow()");
+            return;
+        }
+        closeScope(_scopes.back());
+        _scopes.pop_back();
+    }
+
+    void VRUIBuilder::reset()
+    {
+        _scopes.clear();
+        _rootRetained = Retained{};
+        if (_root) {
+            _root->clearElements();
+            _root->recalculateLayout();
+        }
+    }
+
+    VRUIWidget* VRUIBuilder::find(const std::string& id) const
+    {
+        return _root ? _root->findWidgetByName(id) : nullptr;
+    }
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "VRUIContainer.h"
+#include "VRUIButton.h"
+#include "VRUISlider.h"
+#include "VRUIToggleButton.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vrui
+{
+    /// Visual parameters for buttons created by VRUIBuilder
+    struct ButtonStyle
+    {
+        std::string nifPath = "immersiveUI\\slot01.nif";
+        std::string texturePath = "textures\\test.dds";
+        float width = 3.0f;
+        float height = 1.5f;
+    };
+
+    /// Immediate-mode front end for a retained VRUIContainer tree.
+    ///
+    /// Describe the panel between begin() and end() (every frame or whenever data changes):
+    ///
+    ///   ui.begin();
+    ///   if (ui.button("save", "SAVE")) { ... }
+    ///   ui.beginRow("scale");
+    ///   ui.slider("scaleSlider", &settings.menuScale, 0.1f, 2.0f);
+    ///   ui.endRow();
+    ///   ui.end();
+    ///
+    /// Each call is matched by id against the widgets created on previous passes.
+    /// Only differences reach the scene graph: new ids create widgets, missing ids remove them,
+    /// changed labels/values update the existing widget. A pass identical to the last one does no node work.
+    class VRUIBuilder
+    {
+    public:
+        explicit VRUIBuilder(std::shared_ptr<VRUIContainer> root);
+        ~VRUIBuilder();
+
+        VRUIBuilder(const VRUIBuilder&) = delete;
+        VRUIBuilder& operator=(const VRUIBuilder&) = delete;
+
+        /// Start describing the root container
+        void begin();
+
+        /// Apply structural changes. Returns true if any widget was created, removed or reordered.
+        bool end();
+
+        /// Push button. Returns true once after the button was pressed.
+        bool button(const std::string& id, const std::string& label, const ButtonStyle& style = {});
+
+        /// Consume a press of button `id` of the current container before it is described
+        /// (its button() call then returns false). For rows whose earlier widgets show what a
+        /// later button changes.
+        bool takePress(const std::string& id);
+
+        /// Toggle bound to `value`. Returns true when the user flipped it.
+        bool toggle(const std::string& id, const std::string& label, bool* value, const ButtonStyle& style = {});
+
+        /// Slider bound to `value`. Returns true when the user dragged it (and `value` was written).
+        bool slider(const std::string& id, float* value, float minValue, float maxValue,
+                    float width = 6.0f, float height = 1.0f);
+
+        /// Empty widget used as vertical/horizontal padding
+        void spacer(const std::string& id, float width, float height);
+
+        /// Nested container; calls until endRow() go into it
+        void beginRow(const std::string& id,
+                      ContainerLayout layout = ContainerLayout::HorizontalCenter,
+                      float spacing = 0.4f);
+        void endRow();
+
+        /// Drop every retained widget (next pass recreates them)
+        void reset();
+
+        /// Widget created for `id` in the last pass (nullptr if unknown)
+        VRUIWidget* find(const std::string& id) const;
+
+    private:
+        enum class WidgetKind : uint8_t
+        {
+            Button,
+            Toggle,
+            Slider,
+            Spacer,
+            Row
+        };
+
+        /// Input received from the widget since the last pass (shared with widget callbacks)
+        struct EntryInput
+        {
+            bool pressed = false;
+            bool toggled = false;
+            bool valueChanged = false;
+        };
+
+        struct Retained;
+
+        struct Entry
+        {
+            WidgetKind kind = WidgetKind::Spacer;
+            std::shared_ptr<VRUIWidget> widget;
+            std::shared_ptr<EntryInput> input;
+            std::unique_ptr<Retained> children;  // Rows only
+            uint32_t generation = 0;
+        };
+
+        /// Retained state of one container: widgets by id, plus the order applied last time
+        struct Retained
+        {
+            std::unordered_map<std::string, Entry> entries;
+            std::vector<std::string> order;
+        };
+
+        /// Container currently being described
+        struct Scope
+        {
+            VRUIContainer* container = nullptr;
+            Retained* retained = nullptr;
+            std::vector<std::string> order;
+            bool structureChanged = false;
+        };
+
+        /// Look up (or create, via `create`) the entry for `id` in the current scope
+        template <class Factory>
+        Entry& touch(const std::string& id, WidgetKind kind, Factory&& create);
+
+        /// Apply the described order of `scope` to its container
+        void closeScope(Scope& scope);
+
+        std::shared_ptr<VRUIContainer> _root;
+        Retained _rootRetained;
+        std::vector<Scope> _scopes;
+        uint32_t _generation = 0;
+        bool _changed = false;
+    };
+}
@@ -9,7 +9,12 @@
 #include <RE/B/BSShaderTextureSet.h>
 #include <RE/B/BSVisit.h>
 #include <RE/N/NiNode.h>
-#include "VRUISettings.h"
+#include "VRUISettingsStore.h"
+#include "VRUILabelCache.h"
+#include "VRUIModelCache.h"
+#include "VRUITextureSetRegistry.h"
+#include "VRUIAssetLoader.h"
+#include <utility>
 
 namespace vrui
 {
@@ -42,105 +47,137 @@ namespace vrui
         // Base node already created by VRUIWidget constructor.
         // Now load visual meshes (vtable is ready at this point).
 
-        if (!_nifPath.empty()) {
-            // Try loading custom NIF mesh via BSModelDB
-            auto loaded = loadModelFromNif(_nifPath);
-            if (loaded && _node) {
-                auto& settings = VRUISettings::get();
-                float radX = settings.buttonMeshRotX * (kDegToRad);
-                float radY = settings.buttonMeshRotY * (kDegToRad);
-                float radZ = settings.buttonMeshRotZ * (kDegToRad);
-                loaded->local.rotate.SetEulerAnglesXYZ(radX, radY, radZ);
-
-                RE::NiUpdateData updateData;
-                loaded->Update(updateData);
-
-                // Apply visual scale from settings
-                loaded->local.scale = settings.buttonMeshScale;
-
-                _node->AttachChild(loaded.get());
-                logger::info("ImmersiveUI: Button '{}' loaded NIF '{}' with scale {} and rotation [{}, {}, {}]", 
-                    _label, _nifPath, settings.buttonMeshScale, settings.buttonMeshRotX, settings.buttonMeshRotY, settings.buttonMeshRotZ);
-                return;
+        if (!_nifPath.empty() && _node) {
+            // Custom NIF mesh via the background loader: show a placeholder until it arrives
+            // (the callback runs right away if the mesh is already cached)
+            _meshPlaceholder = VRUIAssetLoader::createPlaceholder(_label);
+            if (_meshPlaceholder) {
+                _node->AttachChild(_meshPlaceholder.get());
             }
+            loadModelAsync(_nifPath, [this, request = _meshRequest](RE::NiPointer<RE::NiNode> loaded) {
+                if (request == _meshRequest) onMeshLoaded(std::move(loaded));
+            });
+            return;
         }
 
+        initializeFallbackVisuals();
+    }
+
+    void VRUIButton::reloadVisuals(const std::string& nifPath, const std::string& texturePath)
+    {
+        if (!_node) return;
+
+        for (auto* mesh : { &_meshPlaceholder, &_meshNode }) {
+            if (*mesh) {
+                _node->DetachChild(mesh->get());
+                *mesh = nullptr;
+            }
+        }
+
+        _meshRequest++;
+        _nifPath = nifPath;
+        std::string oldTexture = std::exchange(_texturePath, texturePath);
+        initializeVisuals();
+
+        // The old meshes are gone; don't keep their texture set around until the menu closes
+        if (oldTexture != _texturePath) {
+            VRUITextureSetRegistry::get().release(oldTexture);
+        }
+    }
+
+    bool VRUIButton::visualsMatch(const std::string& nifPath, const std::string& texturePath) const
+    {
+        auto& settings = VRUISettings::get();
+        return nifPath == _nifPath && texturePath == _texturePath &&
+               (_texturePath.empty() || (settings.flipTextureH == _flipH && settings.flipTextureV == _flipV));
+    }
+
+    void VRUIButton::applyMeshTransform()
+    {
+        if (!_meshNode) return;
+
+        auto& store = VRUISettingsStore::get();
+        uint64_t version = store.version();
+        if (version != 0 && version == _meshTransformVersion) return;
+        _meshTransformVersion = version;
+
+        _meshNode->local.rotate = store.transforms().buttonMeshRotation;
+        _meshNode->local.scale = store.frame().buttonMeshScale;
+
+        RE::NiUpdateData updateData;
+        _meshNode->Update(updateData);
+    }
+
+    void VRUIButton::onMeshLoaded(RE::NiPointer<RE::NiNode> loaded)
+    {
+        if (_meshPlaceholder) {
+            _node->DetachChild(_meshPlaceholder.get());
+            _meshPlaceholder = nullptr;
+        }
+
+        if (loaded && _node) {
+            auto& settings = VRUISettings::get();
+            _meshNode = std::move(loaded);
+            _meshTransformVersion = 0;
+            applyMeshTransform();
+
+            _node->AttachChild(_meshNode.get());
+            logger::info("ImmersiveUI: Button '{}' loaded NIF '{}' with scale {} and rotation [{}, {}, {}]", 
+                _label, _nifPath, settings.buttonMeshScale, settings.buttonMeshRotX, settings.buttonMeshRotY, settings.buttonMeshRotZ);
+            return;
+        }
+
+        initializeFallbackVisuals();
+    }
+
+    void VRUIButton::initializeFallbackVisuals()
+    {
         // Use a game mesh as a visible button placeholder
         // Load the flat plane / marker mesh from game files
-        RE::NiPointer<RE::NiNode> meshNode;
-        RE::BSModelDB::DBTraits::ArgsType args{};
 
-        // Try several common game meshes, with and without prefixes and different slashes
-        // Try several common game meshes, with and without prefixes and different slashes
-        static const char* meshPaths[] = {
+        // Try several common game meshes. Prefix and slash variants of one file resolve to the
+        // same entry, and the resolver remembers misses, so only the first button probes the list.
+        static constexpr const char* meshPaths[] = {
             "immersiveUI\\IconPlane.nif", 
-            "ImmersiveUI\\IconPlane.nif",
-            "meshes\\immersiveUI\\IconPlane.nif",
             "meshes\\PipboyConfigHUDv2.nif",
-            "PipboyConfigHUDv2.nif",
             "FRIK\\PipboyConfigHUDv2.nif",
             "clutter\\common\\bucket01.nif",
-            "meshes\\clutter\\common\\bucket01.nif",
-            "clutter/common/bucket01.nif",
-            "meshes/clutter/common/bucket01.nif",
             "markers\\movemarker01.nif",
             "Sky\\skyrim_moon_v2.nif", // very common base mesh
             "Sky\\Secunda.nif",
             "weapons\\iron\\longsword.nif"
         };
 
-        auto& settings = VRUISettings::get();
-        bool loaded = false;
-        for (auto* path : meshPaths) {
-            auto result = RE::BSModelDB::Demand(path, meshNode, args);
-            logger::info("ImmersiveUI: BSModelDB::Demand test path '{}' result={}", path, static_cast<int>(result));
-            
-            if (result == RE::BSResource::ErrorCode::kNone && meshNode) {
-                auto* cloned = meshNode->Clone();
-                if (cloned && _node) {
-                    auto* cloneNode = cloned->AsNode();
-                    if (cloneNode) {
-                        // Uncull and apply basic transform
-                        RE::BSVisit::TraverseScenegraphGeometries(cloneNode, [&](RE::BSGeometry* a_geometry) -> RE::BSVisit::BSVisitControl {
-                            a_geometry->SetAppCulled(false);
-                            return RE::BSVisit::BSVisitControl::kContinue;
-                        });
-                        cloneNode->SetAppCulled(false);
-                        
-                        // Apply rotation from settings
-                        float radX = settings.buttonMeshRotX * (kDegToRad);
-                        float radY = settings.buttonMeshRotY * (kDegToRad);
-                        float radZ = settings.buttonMeshRotZ * (kDegToRad);
-                        cloneNode->local.rotate.SetEulerAnglesXYZ(radX, radY, radZ);
-
-                        // Apply visual scale from settings
-                        cloneNode->local.scale = settings.buttonMeshScale;
-                        
-                        RE::NiUpdateData updateData;
-                        cloneNode->Update(updateData);
-                        _node->AttachChild(cloneNode);
-                        
-                        loaded = true;
-                        logger::info("ImmersiveUI: Button '{}' using game mesh '{}'", _label, path);
-                        break;
-                    }
-                }
-            }
-        }
-        if (!loaded) {
+        std::string usedPath;
+        auto meshNode = _node ? loadFirstModel(meshPaths, &usedPath) : nullptr;
+        if (meshNode) {
+            // Uncull and apply basic transform
+            RE::BSVisit::TraverseScenegraphGeometries(meshNode.get(), [&](RE::BSGeometry* a_geometry) -> RE::BSVisit::BSVisitControl {
+                a_geometry->SetAppCulled(false);
+                return RE::BSVisit::BSVisitControl::kContinue;
+            });
+            meshNode->SetAppCulled(false);
+
+            // Rotation and scale from settings
+            _meshNode = meshNode;
+            _meshTransformVersion = 0;
+            applyMeshTransform();
+            _node->AttachChild(meshNode.get());
+
+            logger::debug("ImmersiveUI: Button '{}' using game mesh '{}'", _label, usedPath);
+        } else {
             logger::warn("ImmersiveUI: Button '{}' has no visual mesh (all load attempts failed)", _label);
         }
 
         // Apply custom texture if provided
-        if (!_texturePath.empty() && _node) {
-            auto* textureSet = RE::BSShaderTextureSet::Create();
+        if (!_texturePath.empty() && _meshNode) {
+            // Every button showing this icon shares one texture set
+            auto textureSet = VRUITextureSetRegistry::get().acquire(_texturePath);
             if (textureSet) {
-                textureSet->SetTexturePath(RE::BSTextureSet::Texture::kDiffuse, _texturePath.c_str());
-
                 bool textureApplied = false;
 
-                // Find geometries to apply the texture and fix transparency
-                RE::BSVisit::TraverseScenegraphGeometries(_node.get(), [&](RE::BSGeometry* geom) -> RE::BSVisit::BSVisitControl {
+                // Find geometries to apply the texture and fix transparency (the labels keep theirs)
+                RE::BSVisit::TraverseScenegraphGeometries(_meshNode.get(), [&](RE::BSGeometry* geom) -> RE::BSVisit::BSVisitControl {
                     if (geom) {
                         // 1. Fix Transparency (NiAlphaProperty)
                         auto& runtimeData = geom->GetGeometryRuntimeData();
@@ -159,13 +196,16 @@ namespace vrui
                             lightingProp->SetFlags(RE::BSShaderProperty::EShaderPropertyFlag8::kVertexAlpha, true);
                             
                             if (lightingProp->GetBaseMaterial()) {
-                                auto* material = static_cast<RE::BSLightingShaderMaterialBase*>(lightingProp->GetBaseMaterial());
+                                // The mesh may share its material with other instances; override a private copy
+                                auto* material = static_cast<RE::BSLightingShaderMaterialBase*>(
+                                    VRUIModelCache::get().makeMaterialUnique(geom, lightingProp));
                                 if (material) {
-                                    RE::NiPointer<RE::BSTextureSet> texPtr(textureSet);
-                                    material->SetTextureSet(texPtr);
+                                    VRUITextureSetRegistry::get().bind(material, textureSet);
                                     
                                     // Apply UV flipping if requested
                                     auto& settings = VRUISettings::get();
+                                    _flipH = settings.flipTextureH;
+                                    _flipV = settings.flipTextureV;
                                     if (settings.flipTextureH) {
                                         material->texCoordScale[0].x = -1.0f;
                                         material->texCoordOffset[0].x = 1.0f;
@@ -185,8 +225,12 @@ namespace vrui
                         if (effect) {
                             auto* effectProp = netimmerse_cast<RE::BSEffectShaderProperty*>(effect);
                             if (effectProp && effectProp->GetMaterial()) {
-                                effectProp->GetMaterial()->sourceTexturePath = _texturePath;
-                                textureApplied = true;
+                                auto* material = static_cast<RE::BSEffectShaderMaterial*>(
+                                    VRUIModelCache::get().makeMaterialUnique(geom, effectProp));
+                                if (material) {
+                                    material->sourceTexturePath = _texturePath;
+                                    textureApplied = true;
+                                }
                             }
                         }
                     }
@@ -218,115 +262,117 @@ namespace vrui
 
         auto& settings = VRUISettings::get();
 
-        // 1. Clear existing label nodes safely
-        if (_labelNode) {
-            _node->DetachChild(_labelNode.get());
-            _labelNode = nullptr;
-        }
-        if (_sublabelNode) {
-            _node->DetachChild(_sublabelNode.get());
-            _sublabelNode = nullptr;
-        }
+        TextStyle labelStyle;
+        labelStyle.scale = settings.labelScale;
+        labelStyle.advance = settings.labelSpacing;
+        labelStyle.spaceAdvance = settings.labelSpacing * 2.0f;
+        labelStyle.missingAdvance = settings.labelSpacing * 0.5f;
+
+        TextStyle sublabelStyle;
+        sublabelStyle.scale = settings.labelScale * 0.7f;
+        sublabelStyle.advance = settings.labelSpacing * 0.7f;
+        sublabelStyle.spaceAdvance = settings.labelSpacing * 1.5f;
+        sublabelStyle.missingAdvance = 0.0f;
+
+        // Keep labels inside the button: measured against the font metrics, cut with "..." if too long
+        const auto& metrics = FontMetrics::active();
+        std::string label = fitText(_label, metrics, labelStyle, _width);
+        std::string sublabel = fitText(_sublabel, metrics, sublabelStyle, _width);
+
+        updateTextNode(_labelNode, _labelMesh, label, "LabelContainer", labelStyle,
+            { settings.labelXOffset, settings.labelYOffset, settings.labelZOffset });
+        updateTextNode(_sublabelNode, _sublabelMesh, sublabel, "SublabelContainer", sublabelStyle,
+            { settings.labelXOffset, settings.labelYOffset, settings.labelZOffset - 0.5f });
+
+        logger::trace("ImmersiveUI: Refreshed 3D labels for button '{}' (S='{}')", _label, _sublabel);
+    }
 
-        if (_label.empty() && _sublabel.empty()) return;
+    void VRUIButton::updateTextNode(RE::NiPointer<RE::NiNode>& slot, std::unique_ptr<VRUITextMesh>& mesh,
+                                    const std::string& text, const char* nodeName,
+                                    const TextStyle& style, const RE::NiPoint3& offset)
+    {
+        auto detachSlot = [&]() {
+            if (slot) {
+                _node->DetachChild(slot.get());
+                slot = nullptr;
+            }
+        };
 
-        RE::NiUpdateData updateData;
+        if (text.empty()) {
+            detachSlot();
+            return;
+        }
 
-        // 2. Build 3D Label
-        if (!_label.empty()) {
-            _labelNode = RE::NiPointer<RE::NiNode>(RE::NiNode::Create());
-            _labelNode->name = "LabelContainer";
-            _node->AttachChild(_labelNode.get());
+        // Single-mesh path: the label geometry is created once and rewritten in place
+        if (!mesh) {
+            mesh = VRUITextMesh::create(nodeName);
+        }
 
-            float currentX = 0.0f;
-            std::vector<RE::NiPointer<RE::NiAVObject>> charNodes;
+        // A label the glyph pool cannot hold falls back to per-glyph NIFs rather than losing glyphs
+        if (mesh && mesh->setText(text, style)) {
+            if (slot.get() != mesh->getNode()) {
+                detachSlot();
+                slot = RE::NiPointer<RE::NiNode>(mesh->getNode());
+                _node->AttachChild(slot.get());
+            }
+        } else {
+            detachSlot();
+            slot = VRUILabelCache::get().acquire(text, style, [&]() {
+                return buildGlyphNodes(text, nodeName, style);
+            });
+            if (!slot) return;
+            slot->name = nodeName;
+            _node->AttachChild(slot.get());
+        }
 
-            for (char c : _label) {
-                if (c == ' ' || c == '\t') {
-                    currentX += settings.labelSpacing * 2.0f;
-                    continue;
-                }
+        slot->local.translate = offset;
+        slot->local.rotate = VRUISettingsStore::get().transforms().labelRotation;
 
-                char upperC = static_cast<char>(toupper(static_cast<unsigned char>(c)));
-                std::string charNifPath = "immersiveUI\\font\\" + std::string(1, upperC) + ".nif";
+        RE::NiUpdateData updateData;
+        slot->Update(updateData);
+    }
 
-                auto charModel = loadModelFromNif(charNifPath);
-                if (charModel) {
-                    charModel->local.translate.x = currentX;
-                    charModel->local.scale = settings.labelScale;
-                    _labelNode->AttachChild(charModel.get());
-                    charNodes.push_back(charModel);
-                    currentX += settings.labelSpacing;
-                } else {
-                    currentX += settings.labelSpacing * 0.5f;
-                }
-            }
+    std::string VRUIButton::glyphNifPath(char c)
+    {
+        char upperC = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+        return "immersiveUI\\font\\" + std::string(1, upperC) + ".nif";
+    }
 
-            if (!charNodes.empty()) {
-                float totalWidth = currentX - settings.labelSpacing;
-                float centerOffset = -totalWidth / 2.0f;
-                for (auto& node : charNodes) {
-                    node->local.translate.x += centerOffset;
-                }
-                _labelNode->local.translate.x = settings.labelXOffset;
-                _labelNode->local.translate.y = settings.labelYOffset;
-                _labelNode->local.translate.z = settings.labelZOffset;
-
-                float radX = settings.labelRotX * (kDegToRad);
-                float radY = settings.labelRotY * (kDegToRad);
-                float radZ = settings.labelRotZ * (kDegToRad);
-                _labelNode->local.rotate.SetEulerAnglesXYZ(radX, radY, radZ);
+    RE::NiPointer<RE::NiNode> VRUIButton::buildGlyphNodes(const std::string& text, const char* nodeName,
+                                                          const TextStyle& style)
+    {
+        auto container = RE::NiPointer<RE::NiNode>(RE::NiNode::Create());
+        if (!container) return nullptr;
+        container->name = nodeName;
+
+        TextPen pen(FontMetrics::active(), style);
+        float lastX = 0.0f;
+        std::vector<RE::NiPointer<RE::NiNode>> charNodes;
+
+        for (char c : text) {
+            float at = 0.0f;
+            if (pen.step(c, at) != TextPen::Step::Glyph) {
+                continue;
             }
-            _labelNode->Update(updateData);
-        }
-
-        // 3. Build 3D Sublabel
-        if (!_sublabel.empty()) {
-            _sublabelNode = RE::NiPointer<RE::NiNode>(RE::NiNode::Create());
-            _sublabelNode->name = "SublabelContainer";
-            _node->AttachChild(_sublabelNode.get());
-
-            float subX = 0.0f;
-            std::vector<RE::NiPointer<RE::NiAVObject>> subNodes;
-            float subScale = settings.labelScale * 0.7f;
 
-            for (char c : _sublabel) {
-                if (c == ' ' || c == '\t') {
-                    subX += settings.labelSpacing * 1.5f;
-                    continue;
-                }
-                char upperC = static_cast<char>(toupper(static_cast<unsigned char>(c)));
-                std::string subNifPath = "immersiveUI\\font\\" + std::string(1, upperC) + ".nif";
-
-                auto subModel = loadModelFromNif(subNifPath);
-                if (subModel) {
-                    subModel->local.translate.x = subX;
-                    subModel->local.scale = subScale;
-                    _sublabelNode->AttachChild(subModel.get());
-                    subNodes.push_back(subModel);
-                    subX += settings.labelSpacing * 0.7f;
-                }
+            auto charModel = loadModelFromNif(glyphNifPath(c));
+            if (charModel) {
+                charModel->local.translate.x = at;
+                charModel->local.scale = style.scale;
+                container->AttachChild(charModel.get());
+                charNodes.push_back(charModel);
+                lastX = at;
             }
+        }
 
-            if (!subNodes.empty()) {
-                float subTotalWidth = subX - (settings.labelSpacing * 0.7f);
-                float subCenterOffset = -subTotalWidth / 2.0f;
-                for (auto& node : subNodes) {
-                    node->local.translate.x += subCenterOffset;
-                }
-                _sublabelNode->local.translate.x = settings.labelXOffset;
-                _sublabelNode->local.translate.y = settings.labelYOffset;
-                _sublabelNode->local.translate.z = settings.labelZOffset - 0.5f;
-
-                float radX = settings.labelRotX * (kDegToRad);
-                float radY = settings.labelRotY * (kDegToRad);
-                float radZ = settings.labelRotZ * (kDegToRad);
-                _sublabelNode->local.rotate.SetEulerAnglesXYZ(radX, radY, radZ);
+        if (!charNodes.empty()) {
+            float centerOffset = -lastX / 2.0f;
+            for (auto& node : charNodes) {
+                node->local.translate.x += centerOffset;
             }
-            _sublabelNode->Update(updateData);
         }
 
-        logger::info("ImmersiveUI: Refreshed 3D labels for button '{}' (L='{}', S='{}')", _label, _label, _sublabel);
+        return container;
     }
 
     void VRUIButton::setState(ButtonState newState)
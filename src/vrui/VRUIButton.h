@@ -1,6 +1,7 @@
 #pragma once
 
 #include "VRUIWidget.h"
+#include "VRUITextMesh.h"
 #include <RE/B/BSModelDB.h>
 #include <functional>
 
@@ -58,21 +59,63 @@ namespace vrui
         const std::string& getSublabel() const { return _sublabel; }
         void setSublabel(const std::string& text) { _sublabel = text; refreshLabel(); }
 
+        /// Set both texts with a single label refresh
+        void setLabels(const std::string& label, const std::string& sublabel) { _label = label; _sublabel = sublabel; refreshLabel(); }
+
         /// Load visual meshes post-construction (vtable is ready)
         void initializeVisuals() override;
 
-    private:
+        const std::string& getNifPath() const { return _nifPath; }
+        const std::string& getTexturePath() const { return _texturePath; }
+
+        /// Replace the mesh with `nifPath` / `texturePath` (also re-applies the UV flip settings).
+        /// Labels, state and handlers are kept.
+        void reloadVisuals(const std::string& nifPath, const std::string& texturePath);
 
-        /// Refreshes the 3D text label using character NIFs
+        /// True if the mesh was built from these paths with the current UV flip settings
+        bool visualsMatch(const std::string& nifPath, const std::string& texturePath) const;
+
+        /// Re-apply fButtonMeshScale / fButtonMeshRot* to the current mesh (no-op if it already
+        /// has this settings version's transform)
+        void applyMeshTransform();
+
+        /// Refreshes the 3D text labels (single atlas mesh, or character NIFs as fallback)
         void refreshLabel();
 
+        /// Per-glyph fallback NIF for `c` (immersiveUI\\font\\X.nif)
+        static std::string glyphNifPath(char c);
+
+    private:
+        /// Swap the placeholder for the custom NIF (or the fallback mesh if it failed to load)
+        void onMeshLoaded(RE::NiPointer<RE::NiNode> loaded);
+
+        /// Game mesh fallback, custom texture and labels
+        void initializeFallbackVisuals();
+
+        /// Update one label slot: rewrite the atlas mesh in place, or rebuild glyph nodes
+        void updateTextNode(RE::NiPointer<RE::NiNode>& slot, std::unique_ptr<VRUITextMesh>& mesh,
+                            const std::string& text, const char* nodeName,
+                            const TextStyle& style, const RE::NiPoint3& offset);
+
+        /// Fallback: build a label from one cloned font\\X.nif per character
+        static RE::NiPointer<RE::NiNode> buildGlyphNodes(const std::string& text, const char* nodeName,
+                                                          const TextStyle& style);
+
         std::string _label;
         std::string _sublabel;
         std::string _nifPath;
         std::string _texturePath;
         
+        RE::NiPointer<RE::NiNode> _meshPlaceholder;  // Shown while the custom NIF loads
+        RE::NiPointer<RE::NiNode> _meshNode;         // Custom NIF or fallback mesh
+        uint32_t _meshRequest = 0;                   // Bumped by reloadVisuals; older async loads are dropped
+        uint64_t _meshTransformVersion = 0;          // Settings version applied to _meshNode (0 = none)
+        bool _flipH = false;                         // UV flips applied with the custom texture
+        bool _flipV = false;
         RE::NiPointer<RE::NiNode> _labelNode;
         RE::NiPointer<RE::NiNode> _sublabelNode;
+        std::unique_ptr<VRUITextMesh> _labelMesh;
+        std::unique_ptr<VRUITextMesh> _sublabelMesh;
 
         ButtonState _state = ButtonState::Normal;
         float _targetScale = 1.0f;   // Target scale for smooth lerp
@@ -0,0 +1,167 @@
+#include "VRUIConfigWatcher.h"
+#include "VRUIIniReader.h"
+#include <chrono>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+namespace vrui
+{
+    VRUIConfigWatcher& VRUIConfigWatcher::get()
+    {
+        static VRUIConfigWatcher instance;
+        return instance;
+    }
+
+    void VRUIConfigWatcher::start(const std::string& iniPath, Backend backend)
+    {
+        if (_running.exchange(true, std::memory_order_acq_rel)) return;
+
+        uint64_t generation = _generation.fetch_add(1, std::memory_order_acq_rel) + 1;
+        {
+            std::lock_guard lock(_ownWriteMutex);
+            _watchedPath = iniPath;
+            _ownWrite = FileStamp{};
+        }
+
+        // Detached like the asset loader worker: it only holds a path and exits on stop()
+        std::thread(&VRUIConfigWatcher::threadMain, this, std::filesystem::path(iniPath), backend, generation).detach();
+    }
+
+    void VRUIConfigWatcher::stop()
+    {
+        if (!_running.exchange(false, std::memory_order_acq_rel)) return;
+        _generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    std::unique_ptr<VRUISettings> VRUIConfigWatcher::poll()
+    {
+        if (!_pending.load(std::memory_order_relaxed)) return nullptr;
+        return std::unique_ptr<VRUISettings>(_pending.exchange(nullptr, std::memory_order_acquire));
+    }
+
+    void VRUIConfigWatcher::noteOwnWrite(const std::string& path)
+    {
+        if (!isRunning()) return;
+
+        std::lock_guard lock(_ownWriteMutex);
+        std::error_code ec;
+        if (!std::filesystem::equivalent(path, _watchedPath, ec) || ec) return;
+        _ownWrite = stampOf(_watchedPath);
+    }
+
+    VRUIConfigWatcher::Stats VRUIConfigWatcher::getStats() const
+    {
+        return Stats{ _changes.load(), _parses.load(), _replaced.load() };
+    }
+
+    VRUIConfigWatcher::FileStamp VRUIConfigWatcher::stampOf(const std::filesystem::path& path)
+    {
+        FileStamp stamp;
+        std::error_code ec;
+        stamp.time = std::filesystem::last_write_time(path, ec);
+        if (ec) return FileStamp{};
+        stamp.size = std::filesystem::file_size(path, ec);
+        if (ec) return FileStamp{};
+        stamp.exists = true;
+        return stamp;
+    }
+
+    void VRUIConfigWatcher::publish(std::unique_ptr<VRUISettings> snapshot)
+    {
+        auto* previous = _pending.exchange(snapshot.release(), std::memory_order_acq_rel);
+        if (previous) {
+            delete previous;
+            _replaced.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void VRUIConfigWatcher::waitForChange(void* notification, uint32_t timeoutMs)
+    {
+#ifdef _WIN32
+        if (notification) {
+            if (WaitForSingleObject(notification, timeoutMs) == WAIT_OBJECT_0) {
+                FindNextChangeNotification(notification);
+            }
+            return;
+        }
+#else
+        (void)notification;
+#endif
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+    }
+
+    void VRUIConfigWatcher::threadMain(std::filesystem::path path, Backend backend, uint64_t generation)
+    {
+        auto alive = [&]() { return _generation.load(std::memory_order_acquire) == generation; };
+
+        void* notification = nullptr;
+#ifdef _WIN32
+        if (backend == Backend::Native) {
+            auto directory = path.has_parent_path() ? path.parent_path() : std::filesystem::current_path();
+            HANDLE handle = FindFirstChangeNotificationW(directory.c_str(), FALSE,
+                FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_FILE_NAME);
+            if (handle != INVALID_HANDLE_VALUE) {
+                notification = handle;
+            } else {
+                logger::warn("ImmersiveUI: Change notifications unavailable for '{}' (error {}), polling instead",
+                    directory.string(), GetLastError());
+            }
+        }
+#else
+        (void)backend;
+#endif
+        logger::info("ImmersiveUI: Watching '{}' for changes ({})", path.string(),
+            notification ? "change notifications" : "polling");
+
+        FileStamp baseline = stampOf(path);
+        while (alive()) {
+            waitForChange(notification, kPollIntervalMs);
+            if (!alive()) break;
+
+            FileStamp stamp = stampOf(path);
+            if (stamp == baseline) continue;
+            _changes.fetch_add(1, std::memory_order_relaxed);
+
+            // Debounce: wait until the file stops changing
+            for (;;) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(kDebounceMs));
+                FileStamp next = stampOf(path);
+                if (next == stamp || !alive()) break;
+                stamp = next;
+            }
+            if (!alive()) break;
+
+            baseline = stamp;
+            if (!stamp.exists) continue;
+
+            // The plugin's own save (MCM "SAVE INI"): already applied, reloading it would
+            // revert edits made since
+            {
+                std::lock_guard lock(_ownWriteMutex);
+                if (stamp == _ownWrite) continue;
+            }
+
+            // Parse here; the main thread only swaps in the finished snapshot. Read only:
+            // VRUISettings::load would write defaults over a file that vanished meanwhile.
+            auto snapshot = std::make_unique<VRUISettings>();
+            auto result = VRUIIniReader::load(path.string(), *snapshot);
+            if (!result.opened) {
+                baseline = FileStamp{};  // Gone again (mid-save); look at it on the next change
+                continue;
+            }
+            snapshot->validate();
+            _parses.fetch_add(1, std::memory_order_relaxed);
+            publish(std::move(snapshot));
+        }
+
+#ifdef _WIN32
+        if (notification) {
+            FindCloseChangeNotification(notification);
+        }
+#endif
+        logger::info("ImmersiveUI: Stopped watching '{}'", path.string());
+    }
+}
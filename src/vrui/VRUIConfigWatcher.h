@@ -0,0 +1,97 @@
+#pragma once
+
+#include "VRUISettings.h"
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace vrui
+{
+    /// Watches ImmersiveUI.ini on its own thread and parses it there.
+    ///
+    /// Two backends: Polling (std::filesystem timestamps, works everywhere) and Native
+    /// (directory change notifications on Windows, falls back to Polling elsewhere).
+    /// A change is only parsed once the file's time and size have been stable for the
+    /// debounce interval, so editors that save in several writes produce one reload.
+    /// The file is only read (VRUIIniReader), never written: a file missing for a moment
+    /// (delete-then-rename saves) is skipped, not replaced with defaults. Writes the plugin
+    /// makes itself (VRUISettingsWriter) are reported through noteOwnWrite() and become the
+    /// new baseline instead of a reload. The parsed snapshot is handed to the main thread
+    /// through a single lock-free slot: if the main thread has not collected a snapshot
+    /// yet, a newer one replaces it.
+    class VRUIConfigWatcher
+    {
+    public:
+        enum class Backend : uint8_t
+        {
+            Polling,
+            Native
+        };
+
+        struct Stats
+        {
+            uint64_t changes = 0;    // Changes seen (before debouncing)
+            uint64_t parses = 0;     // Snapshots parsed
+            uint64_t replaced = 0;   // Snapshots replaced before the main thread collected them
+        };
+
+        static VRUIConfigWatcher& get();
+
+        /// Start watching `iniPath` (no-op if already running). The current contents are
+        /// taken as the baseline, so only later changes produce snapshots.
+        void start(const std::string& iniPath, Backend backend = Backend::Native);
+
+        /// Ask the thread to exit (it finishes within one wait interval)
+        void stop();
+
+        bool isRunning() const { return _running.load(std::memory_order_acquire); }
+
+        /// Main thread: the newest parsed snapshot since the last call, or nullptr
+        std::unique_ptr<VRUISettings> poll();
+
+        /// Any thread, after the plugin wrote `path`: if it is the watched file, its current
+        /// stamp is what the plugin wrote, so the watcher takes it as the baseline
+        void noteOwnWrite(const std::string& path);
+
+        Stats getStats() const;
+
+        static constexpr uint32_t kPollIntervalMs = 500;
+        static constexpr uint32_t kDebounceMs = 300;
+
+    private:
+        VRUIConfigWatcher() = default;
+
+        struct FileStamp
+        {
+            std::filesystem::file_time_type time{};
+            std::uintmax_t size = 0;
+            bool exists = false;
+
+            bool operator==(const FileStamp&) const = default;
+        };
+
+        static FileStamp stampOf(const std::filesystem::path& path);
+
+        void threadMain(std::filesystem::path path, Backend backend, uint64_t generation);
+
+        /// Block until the file may have changed, stop() was called or `timeoutMs` passed
+        void waitForChange(void* notification, uint32_t timeoutMs);
+
+        void publish(std::unique_ptr<VRUISettings> snapshot);
+
+        std::atomic<bool> _running{ false };
+        std::atomic<uint64_t> _generation{ 0 };  // Bumped by stop(); a thread exits once it no longer matches
+        std::atomic<VRUISettings*> _pending{ nullptr };
+
+        std::mutex _ownWriteMutex;
+        std::filesystem::path _watchedPath;  // Set by start()
+        FileStamp _ownWrite;                 // Stamp after the plugin's last write of the watched file
+
+        std::atomic<uint64_t> _changes{ 0 };
+        std::atomic<uint64_t> _parses{ 0 };
+        std::atomic<uint64_t> _replaced{ 0 };
+    };
+}
@@ -0,0 +1,132 @@
+#include "VRUIConsoleCommand.h"
+#include <RE/I/IFormFactory.h>
+#include <RE/S/SCRIPT_FUNCTION.h>
+#include <RE/S/Script.h>
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace vrui
+{
+    namespace
+    {
+        std::string lowercase(std::string_view text)
+        {
+            std::string result(text);
+            std::transform(result.begin(), result.end(), result.begin(),
+                [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return result;
+        }
+
+        std::string_view trim(std::string_view text)
+        {
+            constexpr std::string_view kSpace = " \t";
+            auto first = text.find_first_not_of(kSpace);
+            if (first == std::string_view::npos) return {};
+            return text.substr(first, text.find_last_not_of(kSpace) - first + 1);
+        }
+
+        /// Lowercase long and short names of every console and script command, read once
+        const std::unordered_set<std::string>& commandNames()
+        {
+            static const std::unordered_set<std::string> names = []() {
+                std::unordered_set<std::string> result;
+                auto addTable = [&result](const RE::SCRIPT_FUNCTION* table, std::uint32_t count) {
+                    if (!table) return;
+                    for (std::uint32_t i = 0; i < count; ++i) {
+                        for (const char* name : { table[i].functionName, table[i].shortName }) {
+                            if (name && *name) result.insert(lowercase(name));
+                        }
+                    }
+                };
+                addTable(RE::SCRIPT_FUNCTION::GetFirstConsoleCommand(), RE::SCRIPT_FUNCTION::Commands::kConsoleCommandsEnd);
+                addTable(RE::SCRIPT_FUNCTION::GetFirstScriptCommand(), RE::SCRIPT_FUNCTION::Commands::kScriptCommandsEnd);
+                return result;
+            }();
+            return names;
+        }
+    }
+
+    std::shared_ptr<const VRUIConsoleCommand> VRUIConsoleCommand::get(std::string_view text)
+    {
+        static std::unordered_map<std::string, std::shared_ptr<const VRUIConsoleCommand>> cache;
+
+        std::string key(trim(text));
+        auto it = cache.find(key);
+        if (it != cache.end()) return it->second;
+
+        std::shared_ptr<const VRUIConsoleCommand> command(new VRUIConsoleCommand(key));
+        cache.emplace(std::move(key), command);
+        return command;
+    }
+
+    std::vector<std::string> VRUIConsoleCommand::splitLines(std::string_view text)
+    {
+        std::vector<std::string> lines;
+        bool quoted = false;
+        std::size_t start = 0;
+        for (std::size_t i = 0; i <= text.size(); ++i) {
+            if (i < text.size() && text[i] == '"') quoted = !quoted;
+            if (i < text.size() && (quoted || text[i] != ';')) continue;
+
+            auto line = trim(text.substr(start, i - start));
+            if (!line.empty()) lines.emplace_back(line);
+            start = i + 1;
+        }
+        return lines;
+    }
+
+    std::string_view VRUIConsoleCommand::verbOf(std::string_view line)
+    {
+        auto verb = line.substr(0, line.find_first_of(" \t"));
+        auto dot = verb.rfind('.');  // "player.additem" / "14.moveto": the reference is not the command
+        return dot == std::string_view::npos ? verb : verb.substr(dot + 1);
+    }
+
+    VRUIConsoleCommand::VRUIConsoleCommand(std::string_view text) :
+        _text(text)
+    {
+        auto lines = splitLines(text);
+        if (lines.empty()) {
+            _error = "no command";
+            return;
+        }
+
+        const auto& known = commandNames();
+        for (const auto& line : lines) {
+            auto verb = verbOf(line);
+            if (!known.contains(lowercase(verb))) {
+                _error = "unknown command '" + std::string(verb) + "'";
+                return;
+            }
+        }
+
+        // Forms are made once here; a press only runs them
+        _lines.reserve(lines.size());
+        for (auto& line : lines) {
+            auto* script = RE::IFormFactory::Create<RE::Script>();
+            if (!script) {
+                _error = "could not create a script form";
+                _lines.clear();
+                return;
+            }
+            script->SetCommand(line);
+            _lines.push_back(Line{ std::move(line), script });
+        }
+    }
+
+    std::string_view VRUIConsoleCommand::run(RE::TESObjectREFR* target) const
+    {
+        for (const auto& line : _lines) {
+            if (!line.script->CompileAndRun(target)) {
+                logger::warn("ImmersiveUI: Console command '{}' failed to compile or run", line.text);
+                return line.text;
+            }
+        }
+        if (!_lines.empty()) {
+            logger::info("ImmersiveUI: Executed console command: '{}'", _text);
+        }
+        return {};
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vrui
+{
+    /// Console command of a "Console:"/"Cmd:" slot, set up when the slot is bound.
+    ///
+    /// The text may hold several commands separated by ';' (outside double quotes), run
+    /// in order: "Console:player.additem f 100; tgm". When the slot is bound, each
+    /// command's name is looked up in the game's console and script command tables, so
+    /// a misspelled command is logged then and the slot runs nothing. Arguments and
+    /// references are only checked by the game's compiler when the command runs:
+    /// CommonLib only offers Script::CompileAndRun, so every run compiles the text again
+    /// and run() reports the commands that fail. Each command keeps one Script form
+    /// holding its text, so a press does not create forms. Commands are shared by
+    /// text, so a rebuilt page or a second slot with the same command reuses them.
+    /// Main thread only.
+    class VRUIConsoleCommand
+    {
+    public:
+        /// Command for `text` (cached by text; never nullptr)
+        static std::shared_ptr<const VRUIConsoleCommand> get(std::string_view text);
+
+        /// Commands in `text` split on ';' outside double quotes, trimmed, empty ones dropped
+        static std::vector<std::string> splitLines(std::string_view text);
+
+        /// Command name of `line`: "player.additem f 1" -> "additem"
+        static std::string_view verbOf(std::string_view line);
+
+        /// Every command name is known to the game
+        bool valid() const { return _error.empty(); }
+
+        /// Why the command cannot run ("" when valid)
+        const std::string& error() const { return _error; }
+
+        const std::string& text() const { return _text; }
+
+        /// Run the commands in order on `target`, stopping at the first one that fails.
+        /// Returns the failing command ("" if all ran). Does nothing if the command is not valid.
+        std::string_view run(RE::TESObjectREFR* target) const;
+
+    private:
+        explicit VRUIConsoleCommand(std::string_view text);
+
+        struct Line
+        {
+            std::string text;
+            RE::Script* script = nullptr;
+        };
+
+        std::string _text;
+        std::string _error;
+        std::vector<Line> _lines;
+    };
+}
@@ -1,7 +1,7 @@
 #include "VRUIContainer.h"
 #include <cmath>
 #include <algorithm>
-#include "VRUISettings.h"
+#include "VRUISettingsStore.h"
 
 #ifdef max
 #undef max
@@ -79,6 +79,34 @@ namespace vrui
         }
     }
 
+    void VRUIContainer::setElements(const std::vector<std::shared_ptr<VRUIWidget>>& elements, bool relayout)
+    {
+        // Detach children that are no longer wanted
+        auto current = getChildren();  // copy
+        for (auto& child : current) {
+            if (std::find(elements.begin(), elements.end(), child) == elements.end()) {
+                removeChild(child);
+            }
+        }
+
+        // Attach the new ones, then adopt the requested order (order only matters for layout)
+        for (auto& element : elements) {
+            if (element && element->getParent() != this) {
+                addChild(element);
+            }
+        }
+        _children.clear();
+        for (auto& element : elements) {
+            if (element) _children.push_back(element);
+        }
+
+        if (relayout) {
+            recalculateLayout();
+        } else {
+            _layoutDirty = true;
+        }
+    }
+
     void VRUIContainer::setLayout(ContainerLayout layout)
     {
         _layout = layout;
@@ -145,16 +173,36 @@ namespace vrui
         }
     }
 
+    void VRUIContainer::refreshLayout()
+    {
+        uint64_t version = VRUISettingsStore::get().version();
+        if (_layoutDirty || version == 0 || version != _layoutVersion) {
+            recalculateLayout();
+        }
+    }
+
     void VRUIContainer::recalculateLayout()
     {
-        _layoutDirty = false;
+        // Our bounds may change, so the containers around us have to lay out again
+        for (auto* parent = getParent(); parent; parent = parent->getParent()) {
+            if (auto* container = dynamic_cast<VRUIContainer*>(parent)) {
+                container->_layoutDirty = true;
+            }
+        }
 
         const auto& children = getChildren();
 
-        // Recursively trigger layout update for all children containers first
+        // Bring child containers up to date first; ones laid out since the last settings
+        // change keep their positions
         for (auto& child : children) {
-            child->recalculateLayout();
+            if (auto* container = dynamic_cast<VRUIContainer*>(child.get())) {
+                container->refreshLayout();
+            } else {
+                child->recalculateLayout();
+            }
         }
+        _layoutDirty = false;
+        _layoutVersion = VRUISettingsStore::get().version();
 
         if (children.empty()) return;
 
@@ -250,7 +298,8 @@ namespace vrui
             int rows = std::ceil((float)numInPage / _gridColumns);
             int cols = std::min(numInPage, _gridColumns);
 
-            float visualScale = VRUISettings::get().buttonMeshScale;
+            const auto& settings = VRUISettingsStore::get().frame();
+            float visualScale = settings.buttonMeshScale;
             float cellW = pageChildren[0]->getWidth() * visualScale;
             float cellH = pageChildren[0]->getHeight() * visualScale;
 
@@ -264,7 +313,7 @@ namespace vrui
                 int r = i / _gridColumns;
                 int c = i % _gridColumns;
 
-                if (VRUISettings::get().invertGridX) {
+                if (settings.invertGridX) {
                     c = (cols - 1) - c;
                 }
 
@@ -34,25 +34,34 @@ namespace vrui
         void removeElement(const std::shared_ptr<VRUIWidget>& element);
         void clearElements();
 
+        /// Replace the children with `elements`, in that order.
+        /// Widgets already attached keep their nodes; only removed/new ones touch the scene graph.
+        void setElements(const std::vector<std::shared_ptr<VRUIWidget>>& elements, bool relayout = true);
+
         /// Recalculate positions of all children based on layout
         void recalculateLayout() override;
 
+        /// Recalculate only if the last pass is stale: the children changed without a relayout,
+        /// a descendant was laid out on its own, or settings were published since
+        void refreshLayout();
+
         ContainerLayout getLayout() const { return _layout; }
         void setLayout(ContainerLayout layout);
         void setSpacing(float spacing);
 
         void setPageSize(int size);
-        void setPage(int page);
-        int getPageSize() const { return _pageSize; }
+        virtual void setPage(int page);
+        int getPageSize() const override { return _pageSize; }
         int getCurrentPage() const { return _currentPage; }
-        int getTotalPages() const;
-        void nextPage();
-        void prevPage();
+        virtual int getTotalPages() const;
+        virtual void nextPage();
+        virtual void prevPage();
 
         void update(float deltaTime) override;
 
-    private:
+    protected:
         bool _layoutDirty = true;
+        uint64_t _layoutVersion = 0;  // Settings version of the last pass (0 = before the first publish)
         ContainerLayout _layout;
         float _spacing;
         int _gridColumns = 3;  // Default for Grid layout
@@ -0,0 +1,149 @@
+#include "VRUIFontMetrics.h"
+
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <sstream>
+
+namespace vrui
+{
+    namespace
+    {
+        std::string_view trim(std::string_view s)
+        {
+            while (!s.empty() && std::isspace(static_cast<unsigned char>(s.front()))) s.remove_prefix(1);
+            while (!s.empty() && std::isspace(static_cast<unsigned char>(s.back()))) s.remove_suffix(1);
+            return s;
+        }
+
+        bool parseFloat(std::string_view s, float& out)
+        {
+            s = trim(s);
+            if (!s.empty() && s.front() == '+') s.remove_prefix(1);
+            auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+            return ec == std::errc{};
+        }
+
+        /// Key naming a single glyph: one character, or 0xNN
+        bool parseGlyphKey(std::string_view key, char& out)
+        {
+            if (key.size() == 1) {
+                out = key[0];
+                return true;
+            }
+            if (key.size() > 2 && key[0] == '0' && (key[1] == 'x' || key[1] == 'X')) {
+                unsigned value = 0;
+                auto [ptr, ec] = std::from_chars(key.data() + 2, key.data() + key.size(), value, 16);
+                if (ec == std::errc{} && value < 256) {
+                    out = static_cast<char>(value);
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    FontMetrics::FontMetrics()
+    {
+        _advance.fill(1.0f);
+        setGlyphs(kDefaultGlyphs);
+    }
+
+    FontMetrics& FontMetrics::active()
+    {
+        static FontMetrics instance;
+        return instance;
+    }
+
+    uint8_t FontMetrics::index(char c)
+    {
+        return static_cast<uint8_t>(std::toupper(static_cast<unsigned char>(c)));
+    }
+
+    void FontMetrics::setGlyphs(std::string_view glyphs)
+    {
+        _glyphs.clear();
+        _present.reset();
+        for (char c : glyphs) {
+            if (std::isspace(static_cast<unsigned char>(c)) || _present.test(index(c))) continue;
+            _present.set(index(c));
+            _glyphs.push_back(static_cast<char>(index(c)));
+        }
+    }
+
+    float FontMetrics::kerning(char left, char right) const
+    {
+        if (_kerning.empty()) return 0.0f;
+        auto it = _kerning.find(pairKey(left, right));
+        return it != _kerning.end() ? it->second : 0.0f;
+    }
+
+    bool FontMetrics::parse(std::string_view text)
+    {
+        std::string_view section;
+        int values = 0;
+
+        while (!text.empty()) {
+            auto eol = text.find('\n');
+            auto line = trim(text.substr(0, eol));
+            text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+
+            if (line.empty() || line.front() == ';') continue;
+
+            if (line.front() == '[') {
+                auto close = line.find(']');
+                section = close != std::string_view::npos ? trim(line.substr(1, close - 1)) : std::string_view{};
+                continue;
+            }
+
+            // Search from 1 so a line may start with a '=' glyph key
+            auto eq = line.find('=', 1);
+            if (eq == std::string_view::npos) continue;
+            auto key = trim(line.substr(0, eq));
+            auto value = line.substr(eq + 1);
+            if (auto comment = value.find(';'); comment != std::string_view::npos) {
+                value = value.substr(0, comment);
+            }
+            value = trim(value);
+
+            if (section == "Font") {
+                if (key == "sGlyphs") {
+                    setGlyphs(value);
+                    values++;
+                } else if (key == "fLineHeight") {
+                    if (parseFloat(value, _lineHeight)) values++;
+                }
+            } else if (section == "Advance") {
+                char glyph = 0;
+                float adv = 0.0f;
+                if (parseGlyphKey(key, glyph) && parseFloat(value, adv)) {
+                    _advance[index(glyph)] = adv;
+                    values++;
+                }
+            } else if (section == "Kerning") {
+                float kern = 0.0f;
+                if (key.size() == 2 && parseFloat(value, kern)) {
+                    _kerning[pairKey(key[0], key[1])] = kern;
+                    values++;
+                }
+            }
+        }
+
+        return values > 0;
+    }
+
+    bool FontMetrics::loadFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return false;
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+
+        // Parse into a fresh table so a reload does not keep entries removed from the file
+        FontMetrics loaded;
+        if (!loaded.parse(buffer.str())) return false;
+        *this = std::move(loaded);
+        return true;
+    }
+}
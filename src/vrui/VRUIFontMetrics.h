@@ -0,0 +1,69 @@
+#pragma once
+
+// Pure font metrics table. No game (RE::) dependencies.
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace vrui
+{
+    /// Per-glyph advance and kerning for the 3D label font.
+    ///
+    /// Values are relative to the label style's base advance (fLabelSpacing), so the
+    /// defaults (every glyph advances 1.0, no kerning) reproduce the fixed-advance layout.
+    /// Glyphs are uppercase-only; lowercase characters map to their uppercase glyph.
+    ///
+    /// File format (Data/SKSE/Plugins/ImmersiveUI_Font.ini):
+    ///   [Font]
+    ///   sGlyphs = ABC...      ; characters the font provides
+    ///   fLineHeight = 2.5     ; line pitch, in advance units
+    ///   [Advance]
+    ///   I = 0.5               ; single character, or 0xNN for '=', ';' and '['
+    ///   [Kerning]
+    ///   AV = -0.15            ; pair adjustment added between A and V
+    class FontMetrics
+    {
+    public:
+        static constexpr std::string_view kDefaultGlyphs = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789+-.,:%/()!?'_#";
+        static constexpr const char* kDefaultPath = "Data/SKSE/Plugins/ImmersiveUI_Font.ini";
+
+        FontMetrics();
+
+        /// Parse the metrics file contents. Unknown lines are ignored; returns false if nothing was read.
+        bool parse(std::string_view text);
+
+        /// Read and parse a metrics file, replacing the current table. Returns false (and keeps it) if missing or empty.
+        bool loadFile(const std::string& path);
+
+        bool hasGlyph(char c) const { return _present.test(index(c)); }
+
+        /// Advance of `c` in advance units (1.0 unless overridden)
+        float advance(char c) const { return _advance[index(c)]; }
+
+        /// Pair adjustment between `left` and `right`, in advance units
+        float kerning(char left, char right) const;
+
+        float lineHeight() const { return _lineHeight; }
+
+        const std::string& glyphs() const { return _glyphs; }
+
+        /// Process-wide metrics used by labels (defaults until loadFile is called on it)
+        static FontMetrics& active();
+
+    private:
+        static uint8_t index(char c);
+        static uint16_t pairKey(char left, char right) { return static_cast<uint16_t>((index(left) << 8) | index(right)); }
+
+        void setGlyphs(std::string_view glyphs);
+
+        std::string _glyphs;
+        std::bitset<256> _present;
+        std::array<float, 256> _advance;
+        std::unordered_map<uint16_t, float> _kerning;
+        float _lineHeight = 2.5f;
+    };
+}
@@ -0,0 +1,223 @@
+#include "VRUIIniReader.h"
+#include "VRUISettingsSchema.h"
+#include <charconv>
+#include "VRUIMappedFile.h"
+#include <unordered_map>
+
+namespace vrui
+{
+    namespace
+    {
+        constexpr char toLower(char c)
+        {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+
+        /// Case-insensitive FNV-1a of section and key
+        constexpr uint64_t keyHash(std::string_view section, std::string_view key)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            auto mix = [&](char c) {
+                hash ^= static_cast<unsigned char>(toLower(c));
+                hash *= 1099511628211ull;
+            };
+            for (char c : section) mix(c);
+            mix('\x1f');  // Keeps "ab"+"c" apart from "a"+"bc"
+            for (char c : key) mix(c);
+            return hash;
+        }
+
+        bool equalsNoCase(std::string_view a, std::string_view b)
+        {
+            if (a.size() != b.size()) return false;
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                if (toLower(a[i]) != toLower(b[i])) return false;
+            }
+            return true;
+        }
+
+        /// Schema fields by hash of (section, key); SlotStrings by hash of (section, suffix)
+        struct KeyTable
+        {
+            std::unordered_map<uint64_t, const SettingField*> fields;
+            std::unordered_map<uint64_t, const SettingField*> slotFields;
+        };
+
+        const KeyTable& keyTable()
+        {
+            static const KeyTable table = []() {
+                KeyTable result;
+                for (const auto& field : settingsSchema()) {
+                    auto& map = field.type == SettingField::Type::SlotStrings ? result.slotFields : result.fields;
+                    map.emplace(keyHash(field.section, field.key), &field);
+                }
+                return result;
+            }();
+            return table;
+        }
+
+        std::string_view trim(std::string_view text)
+        {
+            constexpr std::string_view kSpace = " \t\r\n";
+            auto first = text.find_first_not_of(kSpace);
+            if (first == std::string_view::npos) return {};
+            return text.substr(first, text.find_last_not_of(kSpace) - first + 1);
+        }
+
+        /// Same rules as CSimpleIniA::GetBoolValue
+        bool parseBool(std::string_view value, bool& out)
+        {
+            if (value.empty()) return false;
+            switch (toLower(value[0])) {
+            case 't': case 'y': case '1':
+                out = true;
+                return true;
+            case 'f': case 'n': case '0':
+                out = false;
+                return true;
+            case 'o':
+                if (value.size() < 2) return false;
+                if (toLower(value[1]) == 'n') { out = true; return true; }
+                if (toLower(value[1]) == 'f') { out = false; return true; }
+                return false;
+            default:
+                return false;
+            }
+        }
+
+        /// Leading number like strtol (decimal, or hex with 0x); trailing text is ignored
+        bool parseInt(std::string_view value, int& out)
+        {
+            bool negative = !value.empty() && value[0] == '-';
+            if (!value.empty() && (value[0] == '-' || value[0] == '+')) value.remove_prefix(1);
+
+            int base = 10;
+            if (value.size() > 2 && value[0] == '0' && toLower(value[1]) == 'x') {
+                base = 16;
+                value.remove_prefix(2);
+            }
+
+            long long parsed = 0;
+            auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), parsed, base);
+            if (ec != std::errc() || end == value.data()) return false;
+            out = static_cast<int>(negative ? -parsed : parsed);
+            return true;
+        }
+
+        /// Leading number like strtod; trailing text is ignored
+        bool parseFloat(std::string_view value, float& out)
+        {
+            if (!value.empty() && value[0] == '+') value.remove_prefix(1);
+            double parsed = 0.0;
+            auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+            if (ec != std::errc() || end == value.data()) return false;
+            out = static_cast<float>(parsed);
+            return true;
+        }
+
+        /// "sSlot<N><suffix>" -> slot index and suffix, or false
+        bool splitSlotKey(std::string_view key, int& slot, std::string_view& suffix)
+        {
+            constexpr std::string_view kPrefix = "sslot";
+            if (key.size() <= kPrefix.size() || !equalsNoCase(key.substr(0, kPrefix.size()), kPrefix)) return false;
+            key.remove_prefix(kPrefix.size());
+
+            // The keys are written as "sSlot%d": "sSlot01" is not slot 1 (and is an unknown key)
+            if (key.front() == '0') return false;
+
+            int number = 0;
+            auto [end, ec] = std::from_chars(key.data(), key.data() + key.size(), number);
+            if (ec != std::errc() || number < 1 || number > VRUISlotTable::kMaxSlots) return false;
+
+            slot = number - 1;
+            suffix = key.substr(static_cast<std::size_t>(end - key.data()));
+            return true;
+        }
+
+        bool applyValue(const SettingField& field, int slot, std::string_view value, VRUISettings& settings)
+        {
+            switch (field.type) {
+            case SettingField::Type::Bool:
+                return parseBool(value, settings.*field.boolMember);
+            case SettingField::Type::Int:
+                return parseInt(value, settings.*field.intMember);
+            case SettingField::Type::Float:
+                return parseFloat(value, settings.*field.floatMember);
+            case SettingField::Type::String:
+                (settings.*field.stringMember).assign(value);
+                return true;
+            case SettingField::Type::SlotStrings:
+                settings.slots.set(slot, field.slotMember, value);
+                return true;
+            }
+            return false;
+        }
+    }
+
+    VRUIIniReader::Result VRUIIniReader::load(const std::string& iniPath, VRUISettings& settings)
+    {
+        VRUIMappedFile file;
+        if (!file.open(iniPath)) return Result{};
+
+        auto result = parse(file.view(), settings);
+        result.opened = true;
+        return result;
+    }
+
+    VRUIIniReader::Result VRUIIniReader::parse(std::string_view text, VRUISettings& settings)
+    {
+        Result result;
+        const auto& table = keyTable();
+
+        constexpr std::string_view kBom = "\xEF\xBB\xBF";
+        if (text.starts_with(kBom)) text.remove_prefix(kBom.size());
+
+        std::string_view section;
+        while (!text.empty()) {
+            auto lineEnd = text.find('\n');
+            auto line = trim(text.substr(0, lineEnd));
+            text.remove_prefix(lineEnd == std::string_view::npos ? text.size() : lineEnd + 1);
+
+            if (line.empty() || line[0] == ';' || line[0] == '#') continue;
+
+            if (line[0] == '[') {
+                auto close = line.find(']');
+                section = trim(line.substr(1, close == std::string_view::npos ? std::string_view::npos : close - 1));
+                continue;
+            }
+
+            auto equals = line.find('=');
+            if (equals == std::string_view::npos) continue;
+            auto key = trim(line.substr(0, equals));
+            auto value = trim(line.substr(equals + 1));
+
+            // Hash lookup, then a real comparison so a collision can never set the wrong field
+            const SettingField* field = nullptr;
+            int slot = 0;
+            if (auto it = table.fields.find(keyHash(section, key));
+                it != table.fields.end() && equalsNoCase(it->second->section, section) && equalsNoCase(it->second->key, key)) {
+                field = it->second;
+            } else if (std::string_view suffix; splitSlotKey(key, slot, suffix)) {
+                if (auto slotIt = table.slotFields.find(keyHash(section, suffix));
+                    slotIt != table.slotFields.end() && equalsNoCase(slotIt->second->section, section) &&
+                    equalsNoCase(slotIt->second->key, suffix)) {
+                    field = slotIt->second;
+                }
+            }
+
+            if (!field) {
+                result.unknown++;
+                continue;
+            }
+
+            if (applyValue(*field, slot, value, settings)) {
+                result.applied++;
+            } else {
+                result.invalid++;
+                logger::warn("ImmersiveUI: [{}] {} = '{}' is not a valid value, keeping the previous one", section, key, value);
+            }
+        }
+
+        return result;
+    }
+}
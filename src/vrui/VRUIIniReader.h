@@ -0,0 +1,36 @@
+#pragma once
+
+#include "VRUISettings.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace vrui
+{
+    /// Reads ImmersiveUI.ini straight into VRUISettings.
+    ///
+    /// The file is memory-mapped and tokenized in place: sections, keys and values stay
+    /// string_views into the mapping, keys are matched against hashes of the schema
+    /// (VRUISettingsSchema) computed once, and numbers are parsed with std::from_chars.
+    /// Only string settings allocate. Follows CSimpleIniA's reading rules for the subset
+    /// the plugin writes: keys and sections are case-insensitive, ';' and '#' start
+    /// comments, surrounding whitespace is trimmed and the last duplicate wins.
+    /// Writing still goes through CSimpleIniA (VRUISettings::save).
+    class VRUIIniReader
+    {
+    public:
+        struct Result
+        {
+            bool opened = false;
+            uint32_t applied = 0;   // Keys written into the settings
+            uint32_t unknown = 0;   // Keys not in the schema (ignored)
+            uint32_t invalid = 0;   // Known keys whose value could not be parsed (left unchanged)
+        };
+
+        /// Apply every known key of `iniPath` to `settings`; keys not in the file keep their value
+        static Result load(const std::string& iniPath, VRUISettings& settings);
+
+        /// Same, for INI text already in memory
+        static Result parse(std::string_view text, VRUISettings& settings);
+    };
+}
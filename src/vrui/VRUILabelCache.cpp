@@ -0,0 +1,100 @@
+#include "VRUILabelCache.h"
+#include <CLIBUtil/hash.hpp>
+#include <bit>
+
+namespace vrui
+{
+    VRUILabelCache& VRUILabelCache::get()
+    {
+        static VRUILabelCache instance;
+        return instance;
+    }
+
+    std::size_t VRUILabelCache::KeyHash::operator()(const Key& key) const
+    {
+        uint64_t hash = clib_util::hash::fnv1a_64(key.text);
+        for (float f : { key.scale, key.advance, key.spaceAdvance, key.missingAdvance }) {
+            hash ^= std::bit_cast<uint32_t>(f);
+            hash *= 0x00000100000001B3;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+
+    static RE::NiPointer<RE::NiNode> cloneNode(RE::NiNode* node)
+    {
+        auto* cloned = node ? node->Clone() : nullptr;
+        return RE::NiPointer<RE::NiNode>(cloned ? cloned->AsNode() : nullptr);
+    }
+
+    RE::NiPointer<RE::NiNode> VRUILabelCache::acquire(const std::string& text, const TextStyle& style, const BuildFunc& build)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        Key key{ text, style.scale, style.advance, style.spaceAdvance, style.missingAdvance };
+
+        auto it = _index.find(key);
+        if (it != _index.end()) {
+            // Hit: move to front and hand out a clone
+            _lru.splice(_lru.begin(), _lru, it->second);
+
+            auto start = Clock::now();
+            auto clone = cloneNode(it->second->master.get());
+            _stats.cloneMicros += std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+            _stats.hits++;
+
+            if (clone) return clone;
+
+            // Clone failed: drop the entry and rebuild below
+            _lru.erase(it->second);
+            _index.erase(it);
+        }
+
+        auto start = Clock::now();
+        auto built = build ? build() : nullptr;
+        _stats.buildMicros += std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+        _stats.misses++;
+
+        if (!built || _capacity == 0) return built;
+
+        // Keep the freshly built tree as the master and give the caller a clone of it
+        auto clone = cloneNode(built.get());
+        if (!clone) return built;
+
+        _lru.push_front(Entry{ key, built });
+        _index.emplace(std::move(key), _lru.begin());
+        evictOverCapacity();
+
+        return clone;
+    }
+
+    void VRUILabelCache::setCapacity(std::size_t entries)
+    {
+        _capacity = entries;
+        evictOverCapacity();
+    }
+
+    void VRUILabelCache::clear()
+    {
+        _index.clear();
+        _lru.clear();
+    }
+
+    void VRUILabelCache::evictOverCapacity()
+    {
+        while (_lru.size() > _capacity) {
+            _index.erase(_lru.back().key);
+            _lru.pop_back();
+            _stats.evictions++;
+        }
+    }
+
+    void VRUILabelCache::logStats()
+    {
+        uint64_t lookups = _stats.hits + _stats.misses;
+        if (lookups == _lastReportedLookups) return;
+        _lastReportedLookups = lookups;
+
+        logger::info("ImmersiveUI: Label cache: {} entries, {} hits / {} misses ({:.1f}% hit rate), {} evictions, ~{:.2f} ms build time saved",
+            _lru.size(), _stats.hits, _stats.misses, _stats.hitRate() * 100.0, _stats.evictions, _stats.savedMicros() / 1000.0);
+    }
+}
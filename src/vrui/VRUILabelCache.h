@@ -0,0 +1,89 @@
+#pragma once
+
+#include "VRUITextLayout.h"
+#include <RE/Skyrim.h>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace vrui
+{
+    /// LRU cache of built label subtrees (per-glyph NIF labels).
+    ///
+    /// Keyed by text and glyph style (scale, advances). Rotation and offset are applied to
+    /// the returned root by the caller, so they are not part of the key. A hit returns a
+    /// Clone() of the cached subtree instead of demanding and placing every glyph again.
+    class VRUILabelCache
+    {
+    public:
+        using BuildFunc = std::function<RE::NiPointer<RE::NiNode>()>;
+
+        struct Stats
+        {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t evictions = 0;
+            uint64_t buildMicros = 0;  // Time spent building on misses
+            uint64_t cloneMicros = 0;  // Time spent cloning on hits
+
+            double hitRate() const { return (hits + misses) ? static_cast<double>(hits) / (hits + misses) : 0.0; }
+
+            /// Estimated build time avoided: hits x average build cost, minus what the clones cost
+            double savedMicros() const
+            {
+                if (misses == 0) return 0.0;
+                double avgBuild = static_cast<double>(buildMicros) / misses;
+                return avgBuild * hits - static_cast<double>(cloneMicros);
+            }
+        };
+
+        static VRUILabelCache& get();
+
+        /// Return a label subtree for (text, style), building it with `build` on a miss
+        RE::NiPointer<RE::NiNode> acquire(const std::string& text, const TextStyle& style, const BuildFunc& build);
+
+        void setCapacity(std::size_t entries);
+        void clear();
+
+        const Stats& getStats() const { return _stats; }
+
+        /// Log hit rate and time saved (only if there were lookups since the last report)
+        void logStats();
+
+    private:
+        VRUILabelCache() = default;
+
+        struct Key
+        {
+            std::string text;
+            float scale;
+            float advance;
+            float spaceAdvance;
+            float missingAdvance;
+
+            bool operator==(const Key&) const = default;
+        };
+
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& key) const;
+        };
+
+        struct Entry
+        {
+            Key key;
+            RE::NiPointer<RE::NiNode> master;  // Never attached; only cloned
+        };
+
+        void evictOverCapacity();
+
+        std::list<Entry> _lru;  // Front = most recently used
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> _index;
+        std::size_t _capacity = 64;
+        Stats _stats;
+        uint64_t _lastReportedLookups = 0;
+    };
+}
@@ -0,0 +1,63 @@
+#include "VRUIMappedFile.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vrui
+{
+    VRUIMappedFile::~VRUIMappedFile()
+    {
+#ifdef _WIN32
+        if (_data) UnmapViewOfFile(_data);
+        if (_mapping) CloseHandle(_mapping);
+        if (_file) CloseHandle(_file);
+#else
+        if (_data) munmap(const_cast<char*>(_data), _size);
+#endif
+    }
+
+    bool VRUIMappedFile::open(const std::string& path)
+    {
+#ifdef _WIN32
+        // Share everything: editors may still hold the file while the watcher reads it
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        _file = file;
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(_file, &size)) return false;
+        if (size.QuadPart == 0) return true;
+
+        _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!_mapping) return false;
+        _data = static_cast<const char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!_data) return false;
+        _size = static_cast<std::size_t>(size.QuadPart);
+        return true;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat info{};
+        bool ok = fstat(fd, &info) == 0;
+        if (ok && info.st_size > 0) {
+            void* data = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                _data = static_cast<const char*>(data);
+                _size = static_cast<std::size_t>(info.st_size);
+            } else {
+                ok = false;
+            }
+        }
+        ::close(fd);
+        return ok;
+#endif
+    }
+}
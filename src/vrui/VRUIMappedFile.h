@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace vrui
+{
+    /// Read-only view of a whole file (memory-mapped; empty files map to an empty view).
+    /// Used by the INI reader and the settings cache.
+    class VRUIMappedFile
+    {
+    public:
+        VRUIMappedFile() = default;
+        VRUIMappedFile(const VRUIMappedFile&) = delete;
+        VRUIMappedFile& operator=(const VRUIMappedFile&) = delete;
+        ~VRUIMappedFile();
+
+        /// Map `path`. Returns false if it does not exist or cannot be mapped.
+        bool open(const std::string& path);
+
+        std::string_view view() const { return _data ? std::string_view(_data, _size) : std::string_view(); }
+
+    private:
+        void* _file = nullptr;     // Windows file and mapping HANDLEs
+        void* _mapping = nullptr;
+        const char* _data = nullptr;
+        std::size_t _size = 0;
+    };
+}
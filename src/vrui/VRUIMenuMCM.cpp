@@ -1,7 +1,11 @@
 #include "VRUIMenuMCM.h"
 #include "VRUISettings.h"
 #include "VRMenuManager.h"
+#include "VRUISettingsWriter.h"
+#include "VRUISettingsProfiles.h"
 #include <cstdio>
+#include <string>
+#include <utility>
 
 namespace vrui
 {
@@ -19,76 +23,154 @@ namespace vrui
         _container->setLocalPosition(RE::NiPoint3{ 0.0f, 0.0f, 0.0f });
         addElement(_container);
 
-        auto& settings = VRUISettings::get();
+        // Row ids per MCM field, built once rather than concatenated on every pass
+        _fieldRows.clear();
+        for (const auto& field : settingsSchema()) {
+            if (!field.inMcm()) continue;
+            std::string key = field.key;
+            auto& row = _fieldRows.emplace_back();
+            row.field = &field;
+            row.rowId = _name + "_row_" + key;
+            row.decrId = "Decr_" + key;
+            row.labelId = "Label_" + key;
+            row.incrId = "Incr_" + key;
+        }
+
+        _ui = std::make_unique<VRUIBuilder>(_container);
+        describe();
+
+        createProfileList();
+    }
 
-        // 1. Menu Overall
-        addSettingRow("Menu Scale", "fMenuScale", 0.05f,
-            [&settings]() { return settings.menuScale; },
-            [&settings](float val) { settings.menuScale = val; });
-
-        addSettingRow("Button Spacing", "fButtonSpacing", 0.1f,
-            [&settings]() { 
-                return settings.buttonSpacing; 
-            },
-            [&settings, this](float val) { 
-                settings.buttonSpacing = val;
-                // MCM's own container needs a refresh if we want it to react to ITSELF
-                // Though usually we want it to affect the MAIN menu.
+    const std::string& VRUIMenuMCM::profileAt(std::size_t item)
+    {
+        static const std::string base;
+        return item == 0 ? base : VRUISettingsProfiles::get().nameAt(item - 1);
+    }
+
+    void VRUIMenuMCM::createProfileList()
+    {
+        _profileList = std::make_shared<VRUIVirtualList>(_name + "_Profiles", 1, kProfileRows, 0.3f, 0);
+
+        // Buttons are recycled across pages: a press records the item, update() applies it
+        _profileList->setFactory([this]() -> std::shared_ptr<VRUIWidget> {
+            ButtonStyle style;
+            auto button = std::make_shared<VRUIButton>(_name + "_Profile", style.nifPath, style.texturePath, 4.0f, 0.8f);
+            button->setOnPressHandler([this](VRUIButton* pressed) {
+                _pickedProfile = _profileList->getItemIndex(pressed);
             });
+            return button;
+        });
+        _profileList->setBinder([](VRUIWidget& widget, std::size_t item) {
+            const auto& name = profileAt(item);
+            bool active = name == VRUISettings::get().activeProfile;
+            static_cast<VRUIButton&>(widget).setLabels(name.empty() ? "INI" : name, active ? "ACTIVE" : "");
+        });
+        _profileList->setItemCount(VRUISettingsProfiles::get().count() + 1);
 
-        // 2. Position Controls
-        addSettingRow("Pos Y (Forward)", "fMenuOffsetY", 0.5f,
-            [&settings]() { return settings.menuOffsetY; },
-            [&settings](float val) { settings.menuOffsetY = val; });
+        addElement(_profileList);
+    }
+
+    void VRUIMenuMCM::placeProfileList()
+    {
+        if (!_profileList || !_container) return;
+
+        float settingsWidth = _container->calculateLogicalDimensions().x;
+        float listWidth = _profileList->calculateLogicalDimensions().x;
+        _profileList->setLocalPosition(RE::NiPoint3{ (settingsWidth + listWidth) * 0.5f + 1.0f, 0.0f, 0.0f });
+    }
+
+    void VRUIMenuMCM::update(float deltaTime)
+    {
+        // Consume button presses and pick up external settings changes.
+        // The builder only touches nodes for rows whose text actually changed.
+        if (isShown() && _ui) {
+            describe();
+        }
+
+        if (_pickedProfile != VRUIVirtualList::kUnbound) {
+            std::string profile = profileAt(std::exchange(_pickedProfile, VRUIVirtualList::kUnbound));
+            if (VRMenuManager::get().setProfile(profile)) {
+                RE::DebugNotification(("ImmersiveUI: Profile " + (profile.empty() ? std::string("(none)") : profile)).c_str());
+            }
+            _profileList->invalidateItems();  // Moves the ACTIVE mark
+        }
+
+        VRUIPanel::update(deltaTime);
+    }
 
-        addSettingRow("Pos Z (Up)", "fMenuOffsetZ", 0.5f,
-            [&settings]() { return settings.menuOffsetZ; },
-            [&settings](float val) { settings.menuOffsetZ = val; });
+    void VRUIMenuMCM::describe()
+    {
+        auto& settings = VRUISettings::get();
 
-        // 3. Rotation Controls
-        addSettingRow("Rot X (Pitch)", "fMenuRotX", 5.0f,
-            [&settings]() { return settings.menuRotX; },
-            [&settings](float val) { settings.menuRotX = val; });
+        _ui->begin();
 
-        addSettingRow("Rot Y (Roll)", "fMenuRotY", 5.0f,
-            [&settings]() { return settings.menuRotY; },
-            [&settings](float val) { settings.menuRotY = val; });
+        // 1. One row per schema field that has an MCM label (scale, position, rotation, spacing)
+        SettingsInvalidation changed = SettingsInvalidation::None;
+        for (auto& row : _fieldRows) {
+            changed |= settingRow(row);
+        }
 
-        addSettingRow("Rot Z (Yaw)", "fMenuRotZ", 5.0f,
-            [&settings]() { return settings.menuRotZ; },
-            [&settings](float val) { settings.menuRotZ = val; });
+        if (changed != SettingsInvalidation::None) {
+            VRMenuManager::get().queueSettingsChanges(changed);
+        }
 
         // Padding row (empty spacing)
-        _container->addElement(std::make_shared<VRUIWidget>("Padding", 0, 1.0f));
+        _ui->spacer("Padding", 0.0f, 1.0f);
 
         // 4. Navigation Buttons
-        auto btnRow = std::make_shared<VRUIContainer>(_name + "_nav", ContainerLayout::HorizontalCenter, 1.0f);
-        
-        auto backBtn = std::make_shared<VRUIButton>("Back", "immersiveUI\\slot01.nif", "textures\\test.dds", 3.0f, 1.0f);
-        backBtn->setLabel("BACK");
-        backBtn->setOnPressHandler([this](VRUIButton*) {
+        ButtonStyle navStyle;
+        navStyle.width = 3.0f;
+        navStyle.height = 1.0f;
+
+        _ui->beginRow(_name + "_nav", ContainerLayout::HorizontalCenter, 1.0f);
+        if (_profileList && _profileList->getTotalPages() > 1) {
+            if (_ui->button("ProfilesPrev", "< PROFILES", navStyle)) _profileList->prevPage();
+            if (_ui->button("ProfilesNext", "PROFILES >", navStyle)) _profileList->nextPage();
+        }
+        if (_ui->button("Back", "BACK", navStyle)) {
             if (_onBackHandler) _onBackHandler();
-        });
-        btnRow->addElement(backBtn);
-
-        auto saveBtn = std::make_shared<VRUIButton>("Save", "immersiveUI\\slot01.nif", "textures\\test.dds", 3.0f, 1.0f);
-        saveBtn->setLabel("SAVE INI");
-        saveBtn->setOnPressHandler([](VRUIButton*) {
-            auto& settings = VRUISettings::get();
-            settings.save(settings.getDefaultIniPath());
-            RE::DebugNotification("ImmersiveUI: Settings Saved to INI!");
-        });
-        btnRow->addElement(saveBtn);
-        
-        _container->addElement(btnRow);
+        }
+        if (_ui->button("Save", "SAVE INI", navStyle)) {
+            // With a profile active the edits belong to the profile: its file gets only the
+            // keys that differ from ImmersiveUI.ini, so it stays an overlay
+            auto& profiles = VRUISettingsProfiles::get();
+            std::string path = settings.getDefaultIniPath();
+            std::string profile = settings.activeProfile;
+            const VRUISettings* overlayBase = nullptr;
+            if (!profile.empty()) {
+                path = profiles.pathFor(profile);
+                overlayBase = profiles.find("");
+            }
+
+            // Written on a background thread; repeated presses collapse into one write
+            VRUISettingsWriter::get().save(settings, path, [profile](const VRUISettingsWriter::Result& result) {
+                if (result.ok && !profile.empty()) {
+                    VRUISettingsProfiles::get().reload(profile);  // Now matches the file
+                }
+                RE::DebugNotification(result.ok ? "ImmersiveUI: Settings Saved to INI!" : "ImmersiveUI: Failed to save settings!");
+            }, overlayBase);
+        }
+        _ui->endRow();
+
+        if (_ui->end()) {
+            centerContainer();
+        }
     }
 
     void VRUIMenuMCM::show()
     {
         VRUIPanel::show();
 
+        // Profiles may have been switched from a slot or the API while the MCM was closed
+        if (_profileList) {
+            _profileList->setItemCount(VRUISettingsProfiles::get().count() + 1);
+            _profileList->invalidateItems();
+        }
+
         // Re-center after show (centering depends on scene graph being valid)
         centerContainer();
+        placeProfileList();
     }
 
     void VRUIMenuMCM::recalculateLayout()
@@ -98,6 +180,7 @@ namespace vrui
 
         // Re-center the container so it appears at the same height as the main grid
         centerContainer();
+        placeProfileList();
     }
 
     void VRUIMenuMCM::centerContainer()
@@ -111,50 +194,76 @@ namespace vrui
         _container->setLocalPosition(RE::NiPoint3{ 0.0f, 0.0f, dims.y * 0.5f });
     }
 
-    void VRUIMenuMCM::addSettingRow(const std::string& label, 
-                                 const std::string& settingKey,
-                                 float step,
-                                 std::function<float()> getter,
-                                 std::function<void(float)> setter)
+    SettingsInvalidation VRUIMenuMCM::settingRow(FieldRow& row)
     {
+        auto& settings = VRUISettings::get();
+        const auto& field = *row.field;
         // Row Layout: [-] [ LABEL : VALUE ] [+]
-        auto row = std::make_shared<VRUIContainer>(_name + "_row_" + settingKey, ContainerLayout::HorizontalCenter, 0.4f);
-        
-        // Minus Button
-        auto minusBtn = std::make_shared<VRUIButton>("Decr_" + settingKey, "immersiveUI\\slot01.nif", "textures\\test.dds", 1.2f, 0.8f);
-        minusBtn->setLabel("-");
-        
-        // Value/Label Display (Center)
-        auto labelWidget = std::make_shared<VRUIButton>("Label_" + settingKey, "immersiveUI\\slot01.nif", "textures\\test.dds", 5.5f, 0.8f);
-        
-        auto updateLabel = [label, labelWidget, getter]() {
+        _ui->beginRow(row.rowId, ContainerLayout::HorizontalCenter, 0.4f);
+
+        ButtonStyle stepStyle;
+        stepStyle.width = 1.2f;
+        stepStyle.height = 0.8f;
+
+        ButtonStyle displayStyle;
+        displayStyle.width = 5.5f;
+        displayStyle.height = 0.8f;
+
+        // -1, 0 or +1 steps this frame, applied before the value is shown so the label
+        // never lags a press by a frame
+        int direction = static_cast<int>(_ui->takePress(row.incrId)) - static_cast<int>(_ui->takePress(row.decrId));
+
+        SettingsInvalidation changed = SettingsInvalidation::None;
+        if (direction != 0) {
+            switch (field.type) {
+            case SettingField::Type::Bool:
+                settings.*field.boolMember = direction > 0;
+                break;
+            case SettingField::Type::Int:
+                settings.*field.intMember += direction * static_cast<int>(field.step);
+                break;
+            case SettingField::Type::Float:
+                settings.*field.floatMember += static_cast<float>(direction) * field.step;
+                break;
+            default:
+                break;
+            }
+            field.clamp(settings);
+            changed = field.invalidates;
+        }
+
+        // Re-format only when the value moved (external edits included)
+        double value = 0.0;
+        switch (field.type) {
+        case SettingField::Type::Bool:
+            value = settings.*field.boolMember ? 1.0 : 0.0;
+            break;
+        case SettingField::Type::Int:
+            value = settings.*field.intMember;
+            break;
+        default:
+            value = settings.*field.floatMember;
+            break;
+        }
+        if (value != row.shown) {
             char buf[128];
-            sprintf_s(buf, "%s: %.2f", label.c_str(), getter());
-            labelWidget->setLabel(buf);
-        };
-        updateLabel();
-
-        // Interaction logic
-        minusBtn->setOnPressHandler([updateLabel, getter, setter, step](VRUIButton*) {
-            setter(getter() - step);
-            updateLabel();
-            VRMenuManager::get().refreshActivePanels();
-        });
+            if (field.type == SettingField::Type::Bool) {
+                std::snprintf(buf, sizeof(buf), "%s: %s", field.label, value != 0.0 ? "ON" : "OFF");
+            } else if (field.type == SettingField::Type::Int) {
+                std::snprintf(buf, sizeof(buf), "%s: %d", field.label, static_cast<int>(value));
+            } else {
+                std::snprintf(buf, sizeof(buf), "%s: %.2f", field.label, value);
+            }
+            row.text = buf;
+            row.shown = value;
+        }
 
-        // Plus Button
-        auto plusBtn = std::make_shared<VRUIButton>("Incr_" + settingKey, "immersiveUI\\slot01.nif", "textures\\test.dds", 1.2f, 0.8f);
-        plusBtn->setLabel("+");
-        plusBtn->setOnPressHandler([updateLabel, getter, setter, step](VRUIButton*) {
-            setter(getter() + step);
-            updateLabel();
-            VRMenuManager::get().refreshActivePanels();
-        });
+        _ui->button(row.decrId, "-", stepStyle);
+        _ui->button(row.labelId, row.text, displayStyle);
+        _ui->button(row.incrId, "+", stepStyle);
 
-        // Add to row in order: [-] [Display] [+]
-        row->addElement(minusBtn);
-        row->addElement(labelWidget);
-        row->addElement(plusBtn);
+        _ui->endRow();
 
-        _container->addElement(row);
+        return changed;
     }
 }
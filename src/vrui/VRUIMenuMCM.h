@@ -3,6 +3,11 @@
 #include "VRUIPanel.h"
 #include "VRUIContainer.h"
 #include "VRUIButton.h"
+#include "VRUIBuilder.h"
+#include "VRUISettingsSchema.h"
+#include "VRUIVirtualList.h"
+#include <limits>
+#include <vector>
 
 namespace vrui
 {
@@ -10,7 +15,9 @@ namespace vrui
      * @brief A specialized panel for in-game configuration (Virtual MCM).
      * 
      * Allows adjusting VRUISettings values in real-time, performing saving, 
-     * and immediate layout updates.
+     * and immediate layout updates. Settings profiles are listed in a column
+     * beside the settings (a VRUIVirtualList, so only one page of buttons exists
+     * however many profiles are installed); pressing one switches to it.
      */
     class VRUIMenuMCM : public VRUIPanel
     {
@@ -26,20 +33,51 @@ namespace vrui
         /// Override layout to always re-center content vertically after layout
         void recalculateLayout() override;
 
+        /// Re-describes the controls while shown (no-op for the scene graph when nothing changed)
+        void update(float deltaTime) override;
+
         void setOnBackHandler(std::function<void()> handler) { _onBackHandler = handler; }
 
     private:
         /// Helper: center the MCM container vertically
         void centerContainer();
 
-        /// Helper to create a setting row (Label + Decr Button + Value Display + Incr Button)
-        void addSettingRow(const std::string& label, 
-                         const std::string& settingKey,
-                         float step,
-                         std::function<float()> getter,
-                         std::function<void(float)> setter);
+        /// Create the profile list (pooled buttons, bound by item index)
+        void createProfileList();
+
+        /// Put the profile list to the right of the settings column
+        void placeProfileList();
+
+        /// Profile name of list item `item` (item 0 is ImmersiveUI.ini itself, "")
+        static const std::string& profileAt(std::size_t item);
+
+        /// Describe the whole MCM layout through the immediate-mode builder
+        void describe();
+
+        /// Builder ids and value text of the row of one schema field (made once, reused every pass)
+        struct FieldRow
+        {
+            const SettingField* field = nullptr;
+            std::string rowId;
+            std::string decrId;
+            std::string labelId;
+            std::string incrId;
+            std::string text;                                          // "<label>: <value>"
+            double shown = std::numeric_limits<double>::quiet_NaN();  // Value `text` was formatted from
+        };
+
+        /// Helper to describe a setting row (Decr Button + Label/Value Display + Incr Button).
+        /// Returns the field's invalidation flags if it was changed.
+        SettingsInvalidation settingRow(FieldRow& row);
+
+        static constexpr int kProfileRows = 6;
+
+        std::vector<FieldRow> _fieldRows;
 
         std::shared_ptr<VRUIContainer> _container;
+        std::shared_ptr<VRUIVirtualList> _profileList;
+        std::size_t _pickedProfile = VRUIVirtualList::kUnbound;  // Pressed item, applied in update()
+        std::unique_ptr<VRUIBuilder> _ui;
         std::function<void()> _onBackHandler;
     };
 }
@@ -0,0 +1,110 @@
+#include "VRUIMeshBuilder.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace vrui
+{
+    namespace
+    {
+        struct Point
+        {
+            float x;
+            float z;
+        };
+
+        MeshVertex makeVertex(const MeshRect& uvRect, Point p, float depth, const MeshColor& color)
+        {
+            MeshVertex vertex;
+            vertex.x = p.x;
+            vertex.y = depth;
+            vertex.z = p.z;
+            float w = uvRect.width();
+            float h = uvRect.height();
+            vertex.u = w != 0.0f ? (p.x - uvRect.left) / w : 0.0f;
+            vertex.v = h != 0.0f ? (uvRect.top - p.z) / h : 0.0f;
+            vertex.color = color;
+            return vertex;
+        }
+
+        /// Corners in quad order (bottom-left, bottom-right, top-right, top-left)
+        void appendCorners(MeshData& mesh, const MeshRect& uvRect, const Point (&corners)[4], float depth, const MeshColor& color)
+        {
+            auto base = static_cast<std::uint16_t>(mesh.vertices.size());
+            for (const auto& corner : corners) {
+                mesh.vertices.push_back(makeVertex(uvRect, corner, depth, color));
+            }
+            for (std::uint16_t i : { 0, 1, 2, 0, 2, 3 }) {
+                mesh.indices.push_back(static_cast<std::uint16_t>(base + i));
+            }
+        }
+
+        void appendRect(MeshData& mesh, const MeshRect& uvRect, const MeshRect& rect, float depth, const MeshColor& color)
+        {
+            const Point corners[4] = {
+                { rect.left, rect.bottom }, { rect.right, rect.bottom }, { rect.right, rect.top }, { rect.left, rect.top }
+            };
+            appendCorners(mesh, uvRect, corners, depth, color);
+        }
+    }
+
+    void appendQuad(MeshData& mesh, const MeshRect& rect, const MeshColor& color, float depth)
+    {
+        appendRect(mesh, rect, rect, depth, color);
+    }
+
+    void appendRoundedRect(MeshData& mesh, const MeshRect& rect, float radius, int cornerSegments,
+                           const MeshColor& color, float depth)
+    {
+        float r = std::clamp(radius, 0.0f, std::min(rect.width(), rect.height()) * 0.5f);
+        if (r <= 0.0f || cornerSegments < 1) {
+            appendQuad(mesh, rect, color, depth);
+            return;
+        }
+
+        // Cross of three rectangles: a full-height middle column and the two side strips
+        appendRect(mesh, rect, { rect.left + r, rect.bottom, rect.right - r, rect.top }, depth, color);
+        appendRect(mesh, rect, { rect.left, rect.bottom + r, rect.left + r, rect.top - r }, depth, color);
+        appendRect(mesh, rect, { rect.right - r, rect.bottom + r, rect.right, rect.top - r }, depth, color);
+
+        // Corner fans, counterclockwise from each corner's start angle
+        const Point centers[4] = {
+            { rect.right - r, rect.bottom + r }, { rect.right - r, rect.top - r },
+            { rect.left + r, rect.top - r }, { rect.left + r, rect.bottom + r }
+        };
+        const float startAngles[4] = { -0.5f, 0.0f, 0.5f, 1.0f };  // x pi
+
+        float step = (std::numbers::pi_v<float> * 0.5f) / static_cast<float>(cornerSegments);
+        for (int c = 0; c < 4; ++c) {
+            float start = startAngles[c] * std::numbers::pi_v<float>;
+            for (int s = 0; s < cornerSegments; ++s) {
+                float a0 = start + step * static_cast<float>(s);
+                float a1 = a0 + step;
+                Point p0{ centers[c].x + r * std::cos(a0), centers[c].z + r * std::sin(a0) };
+                Point p1{ centers[c].x + r * std::cos(a1), centers[c].z + r * std::sin(a1) };
+                const Point corners[4] = { centers[c], p0, p1, p1 };
+                appendCorners(mesh, rect, corners, depth, color);
+            }
+        }
+    }
+
+    void appendSegmentedBar(MeshData& mesh, const MeshRect& rect, int segments, float gapFraction,
+                            const MeshColor& color, float depth)
+    {
+        if (segments < 1) return;
+
+        float cell = rect.width() / static_cast<float>(segments);
+        float gap = cell * std::clamp(gapFraction, 0.0f, 0.9f);
+        for (int i = 0; i < segments; ++i) {
+            float left = rect.left + cell * static_cast<float>(i) + gap * 0.5f;
+            appendRect(mesh, rect, { left, rect.bottom, left + cell - gap, rect.top }, depth, color);
+        }
+    }
+
+    void appendProgressFill(MeshData& mesh, const MeshRect& rect, float fraction,
+                            const MeshColor& color, float depth)
+    {
+        float filled = rect.width() * std::clamp(fraction, 0.0f, 1.0f);
+        appendRect(mesh, rect, { rect.left, rect.bottom, rect.left + filled, rect.top }, depth, color);
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+// Pure procedural geometry. No game (RE::) dependencies: this header and its .cpp
+// can be compiled and exercised outside the game.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vrui
+{
+    struct MeshColor
+    {
+        float r = 1.0f;
+        float g = 1.0f;
+        float b = 1.0f;
+        float a = 1.0f;
+
+        bool operator==(const MeshColor&) const = default;
+    };
+
+    /// One vertex in widget space: X right, Z up, Y depth (as used for widget offsets)
+    struct MeshVertex
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+        float u = 0.0f;
+        float v = 0.0f;
+        MeshColor color;
+    };
+
+    /// Axis-aligned rectangle in the widget's XZ plane
+    struct MeshRect
+    {
+        float left = 0.0f;
+        float bottom = 0.0f;
+        float right = 0.0f;
+        float top = 0.0f;
+
+        float width() const { return right - left; }
+        float height() const { return top - bottom; }
+
+        /// `width` x `height` centered on the origin
+        static MeshRect centered(float width, float height)
+        {
+            return MeshRect{ -width * 0.5f, -height * 0.5f, width * 0.5f, height * 0.5f };
+        }
+    };
+
+    /// Generated geometry, always made of quads so it fits a quad-pool mesh.
+    /// Quad q owns vertices 4q..4q+3 (bottom-left, bottom-right, top-right, top-left)
+    /// and indices 6q..6q+5 (triangles 0-1-2 and 0-2-3). Triangles are quads whose last
+    /// two corners coincide.
+    struct MeshData
+    {
+        std::vector<MeshVertex> vertices;
+        std::vector<std::uint16_t> indices;
+
+        std::size_t quadCount() const { return vertices.size() / 4; }
+        std::size_t triangleCount() const { return indices.size() / 3; }
+
+        void clear()
+        {
+            vertices.clear();
+            indices.clear();
+        }
+    };
+
+    /// Filled rectangle. UVs span the rectangle (u left to right, v top to bottom).
+    void appendQuad(MeshData& mesh, const MeshRect& rect, const MeshColor& color, float depth = 0.0f);
+
+    /// Rectangle with corners rounded by `radius` (clamped to half the shorter side),
+    /// each corner a fan of `cornerSegments` triangles. UVs span the bounding rectangle.
+    void appendRoundedRect(MeshData& mesh, const MeshRect& rect, float radius, int cornerSegments,
+                           const MeshColor& color, float depth = 0.0f);
+
+    /// `segments` equal cells across `rect`, separated by gaps of `gapFraction` of a cell
+    void appendSegmentedBar(MeshData& mesh, const MeshRect& rect, int segments, float gapFraction,
+                            const MeshColor& color, float depth = 0.0f);
+
+    /// Left part of `rect` covering `fraction` (clamped to 0..1). Always exactly one quad,
+    /// zero-area when empty, so a fill can be rewritten in place as the value changes.
+    void appendProgressFill(MeshData& mesh, const MeshRect& rect, float fraction,
+                            const MeshColor& color, float depth = 0.0f);
+}
@@ -0,0 +1,321 @@
+#include "VRUIModelCache.h"
+#include "VRUISettings.h"
+#include <RE/B/BSDynamicTriShape.h>
+#include <RE/B/BSVisit.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace vrui
+{
+    namespace
+    {
+        RE::BSShaderProperty* shaderPropertyOf(RE::BSGeometry* geom)
+        {
+            auto* effect = geom->GetGeometryRuntimeData().properties[RE::BSGeometry::States::kEffect].get();
+            return netimmerse_cast<RE::BSShaderProperty*>(effect);
+        }
+
+        bool isEffectShader(RE::BSShaderProperty* prop)
+        {
+            return netimmerse_cast<RE::BSEffectShaderProperty*>(prop) != nullptr;
+        }
+
+        std::size_t propertySize(RE::BSShaderProperty* prop)
+        {
+            return isEffectShader(prop) ? sizeof(RE::BSEffectShaderProperty) : sizeof(RE::BSLightingShaderProperty);
+        }
+
+        std::size_t materialSize(RE::BSShaderProperty* prop)
+        {
+            return isEffectShader(prop) ? sizeof(RE::BSEffectShaderMaterial) : sizeof(RE::BSLightingShaderMaterialBase);
+        }
+
+        std::vector<RE::BSGeometry*> collectGeometries(RE::NiAVObject* root)
+        {
+            std::vector<RE::BSGeometry*> geometries;
+            RE::BSVisit::TraverseScenegraphGeometries(root, [&](RE::BSGeometry* geom) -> RE::BSVisit::BSVisitControl {
+                geometries.push_back(geom);
+                return RE::BSVisit::BSVisitControl::kContinue;
+            });
+            return geometries;
+        }
+    }
+
+    VRUIModelCache& VRUIModelCache::get()
+    {
+        static VRUIModelCache instance;
+        return instance;
+    }
+
+    std::size_t VRUIModelCache::estimateSize(RE::NiAVObject* root)
+    {
+        if (!root) return 0;
+
+        std::size_t bytes = 0;
+        RE::BSVisit::TraverseScenegraphObjects(root, [&](RE::NiAVObject* object) -> RE::BSVisit::BSVisitControl {
+            bytes += object->AsNode() ? sizeof(RE::NiNode) : sizeof(RE::BSTriShape);
+            return RE::BSVisit::BSVisitControl::kContinue;
+        });
+
+        RE::BSVisit::TraverseScenegraphGeometries(root, [&](RE::BSGeometry* geom) -> RE::BSVisit::BSVisitControl {
+            if (auto* dynamic = netimmerse_cast<RE::BSDynamicTriShape*>(geom)) {
+                bytes += dynamic->GetDynamicTrishapeRuntimeData().dataSize;
+            }
+            if (auto* shape = geom->AsTriShape()) {
+                const auto& data = shape->GetTrishapeRuntimeData();
+                std::size_t vertexSize = geom->GetGeometryRuntimeData().vertexDesc.GetSize();
+                bytes += static_cast<std::size_t>(data.vertexCount) * vertexSize;
+                bytes += static_cast<std::size_t>(data.triangleCount) * 3 * sizeof(std::uint16_t);
+            }
+            return RE::BSVisit::BSVisitControl::kContinue;
+        });
+
+        return bytes;
+    }
+
+    RE::NiPointer<RE::NiNode> VRUIModelCache::instantiate(RE::NiNode* master)
+    {
+        if (!master) return nullptr;
+
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+
+        auto* cloned = master->Clone();
+        auto clone = RE::NiPointer<RE::NiNode>(cloned ? cloned->AsNode() : nullptr);
+        if (!clone) return nullptr;
+
+        std::size_t objectBytes = 0;
+        RE::BSVisit::TraverseScenegraphObjects(clone.get(), [&](RE::NiAVObject* object) -> RE::BSVisit::BSVisitControl {
+            objectBytes += object->AsNode() ? sizeof(RE::NiNode) : sizeof(RE::BSTriShape);
+            return RE::BSVisit::BSVisitControl::kContinue;
+        });
+
+        // Clone() keeps the scene graph order, so geometries pair up with the master's by index
+        auto cloneGeometries = collectGeometries(clone.get());
+        std::vector<RE::BSGeometry*> masterGeometries;
+        bool instanced = VRUISettings::get().modelInstancing;
+        if (instanced) {
+            masterGeometries = collectGeometries(master);
+            instanced = masterGeometries.size() == cloneGeometries.size();
+        }
+
+        for (std::size_t i = 0; i < cloneGeometries.size(); ++i) {
+            auto* geom = cloneGeometries[i];
+            auto* prop = shaderPropertyOf(geom);
+            if (!prop) continue;
+            objectBytes += propertySize(prop);
+
+            auto* masterProp = instanced ? shaderPropertyOf(masterGeometries[i]) : nullptr;
+            if (!masterProp || !masterProp->material || !prop->material) {
+                if (prop->material) _cloneStats.materialBytes += materialSize(prop);
+                continue;
+            }
+
+            if (prop->material != masterProp->material) {
+                // Drop the private copy and bind the master's (the game refcounts shared materials)
+                prop->SetMaterial(masterProp->material, false);
+                prop->SetupGeometry(geom);
+                prop->FinishSetupGeometry(geom);
+            }
+            _sharedMaterials.try_emplace(prop->material, prop->material);
+            _cloneStats.sharedMaterials++;
+            _cloneStats.sharedMaterialBytes += materialSize(prop);
+        }
+
+        _cloneStats.clones++;
+        if (instanced) _cloneStats.instanced++;
+        _cloneStats.objectBytes += objectBytes;
+        _cloneStats.cloneMicros += static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+        return clone;
+    }
+
+    RE::BSShaderMaterial* VRUIModelCache::makeMaterialUnique(RE::BSGeometry* geom, RE::BSShaderProperty* prop)
+    {
+        if (!geom || !prop || !prop->material) return nullptr;
+        if (!_sharedMaterials.contains(prop->material)) return prop->material;
+
+        // Same copy sequence the game uses when it swaps a material per reference
+        auto* copy = prop->material->Create();
+        if (!copy) return nullptr;
+        copy->CopyMembers(prop->material);
+        prop->SetMaterial(copy, true);
+        prop->SetupGeometry(geom);
+        prop->FinishSetupGeometry(geom);
+        copy->~BSShaderMaterial();
+        RE::free(copy);
+
+        _cloneStats.overrides++;
+        _cloneStats.materialBytes += materialSize(prop);
+        return prop->material;
+    }
+
+    void VRUIModelCache::releaseUnusedMaterials()
+    {
+        std::erase_if(_sharedMaterials, [&](const auto& entry) {
+            bool unused = entry.second->QRefCount() <= 1;
+            if (unused) _cloneStats.materialsReleased++;
+            return unused;
+        });
+        _cloneStats.liveSharedMaterials = _sharedMaterials.size();
+    }
+
+    RE::NiPointer<RE::NiNode> VRUIModelCache::find(std::string_view nifPath)
+    {
+        auto it = findEntry(nifPath);
+        if (it == _index.end()) {
+            _stats.misses++;
+            return nullptr;
+        }
+
+        _lru.splice(_lru.begin(), _lru, it->second);
+        _stats.hits++;
+        return it->second->root;
+    }
+
+    bool VRUIModelCache::contains(std::string_view nifPath) const
+    {
+        return findEntry(nifPath) != _index.end();
+    }
+
+    void VRUIModelCache::insert(std::string_view nifPath, RE::NiPointer<RE::NiNode> root)
+    {
+        if (!root) return;
+
+        ResourceKey key(nifPath);
+        auto it = _index.find(key);
+        if (it != _index.end() && !ResourceKey::samePath(it->second->path, nifPath)) {
+            logger::warn("ImmersiveUI: Model cache key of '{}' collides with '{}', not caching it", nifPath, it->second->path);
+            return;
+        }
+        if (it != _index.end()) {
+            // Replace the master in place (e.g. the loader finished after a synchronous load)
+            auto& entry = *it->second;
+            if (!entry.pinned) _unpinnedBytes -= entry.bytes;
+            _stats.bytes -= entry.bytes;
+            entry.root = std::move(root);
+            entry.bytes = estimateSize(entry.root.get());
+            if (!entry.pinned) _unpinnedBytes += entry.bytes;
+            _stats.bytes += entry.bytes;
+            _lru.splice(_lru.begin(), _lru, it->second);
+        } else {
+            Entry entry{ key, std::string(nifPath), std::move(root), 0, _pins.contains(key) };
+            entry.bytes = estimateSize(entry.root.get());
+            if (!entry.pinned) {
+                _unpinnedEntries++;
+                _unpinnedBytes += entry.bytes;
+            }
+            _stats.bytes += entry.bytes;
+            _stats.insertions++;
+
+            _lru.push_front(std::move(entry));
+            _index.emplace(key, _lru.begin());
+        }
+
+        _stats.peakBytes = std::max(_stats.peakBytes, _stats.bytes);
+        evictOverBudget();
+        updateCounts();
+    }
+
+    void VRUIModelCache::pin(std::string_view nifPath, bool pinned)
+    {
+        ResourceKey key(nifPath);
+        if (pinned) {
+            _pins.insert(key);
+        } else {
+            _pins.erase(key);
+        }
+
+        auto it = findEntry(nifPath);
+        if (it != _index.end() && it->second->pinned != pinned) {
+            auto& entry = *it->second;
+            entry.pinned = pinned;
+            if (pinned) {
+                _unpinnedEntries--;
+                _unpinnedBytes -= entry.bytes;
+            } else {
+                _unpinnedEntries++;
+                _unpinnedBytes += entry.bytes;
+            }
+            evictOverBudget();
+        }
+        updateCounts();
+    }
+
+    void VRUIModelCache::setBudget(std::size_t maxEntries, std::size_t maxBytes)
+    {
+        _maxEntries = maxEntries;
+        _maxBytes = maxBytes;
+        evictOverBudget();
+        updateCounts();
+    }
+
+    void VRUIModelCache::clear()
+    {
+        // Pins survive: they describe which paths matter, not what is loaded
+        _index.clear();
+        _lru.clear();
+        _unpinnedEntries = 0;
+        _unpinnedBytes = 0;
+        _stats.bytes = 0;
+        updateCounts();
+    }
+
+    void VRUIModelCache::evictOverBudget()
+    {
+        auto overBudget = [&]() {
+            return (_maxEntries > 0 && _unpinnedEntries > _maxEntries) ||
+                   (_maxBytes > 0 && _unpinnedBytes > _maxBytes);
+        };
+
+        // Walk from the least recently used end, skipping pinned entries
+        auto it = _lru.end();
+        while (overBudget() && it != _lru.begin()) {
+            --it;
+            if (it->pinned) continue;
+
+            _unpinnedEntries--;
+            _unpinnedBytes -= it->bytes;
+            _stats.bytes -= it->bytes;
+            _stats.evictions++;
+            logger::trace("ImmersiveUI: Model cache evicted '{}' (~{} KB)", it->path, it->bytes / 1024);
+
+            _index.erase(it->key);
+            it = _lru.erase(it);
+        }
+    }
+
+    void VRUIModelCache::updateCounts()
+    {
+        _stats.entries = _lru.size();
+        _stats.pinned = _lru.size() - _unpinnedEntries;
+    }
+
+    void VRUIModelCache::logStats()
+    {
+        uint64_t lookups = _stats.hits + _stats.misses;
+        if (lookups == _lastReportedLookups) return;
+        _lastReportedLookups = lookups;
+
+        logger::info("ImmersiveUI: Model cache: {} entries ({} pinned), ~{:.1f} MB (peak {:.1f} MB, budget {} entries / {:.1f} MB), "
+                     "{} hits / {} misses ({:.1f}% hit rate), {} evictions",
+            _stats.entries, _stats.pinned, _stats.bytes / (1024.0 * 1024.0), _stats.peakBytes / (1024.0 * 1024.0),
+            _maxEntries, _maxBytes / (1024.0 * 1024.0), _stats.hits, _stats.misses, _stats.hitRate() * 100.0, _stats.evictions);
+
+        const auto& clones = _cloneStats;
+        if (clones.clones == _lastReportedClones) return;
+        _lastReportedClones = clones.clones;
+
+        // Before = what deep clones allocate (bModelInstancing off, or every shared material
+        // counted as a private copy); after = what was allocated with sharing
+        double afterKB = (clones.objectBytes + clones.materialBytes) / 1024.0;
+        double beforeKB = afterKB + clones.sharedMaterialBytes / 1024.0;
+        logger::info("ImmersiveUI: Model clones: {} ({} instanced), {:.1f} us avg, per-instance data ~{:.1f} KB before / "
+                     "~{:.1f} KB after ({:.1f} KB private materials), {} materials shared, {} copy-on-write overrides, "
+                     "{} shared materials live ({} released)",
+            clones.clones, clones.instanced, static_cast<double>(clones.cloneMicros) / clones.clones, beforeKB, afterKB,
+            clones.materialBytes / 1024.0, clones.sharedMaterials, clones.overrides, clones.liveSharedMaterials,
+            clones.materialsReleased);
+    }
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "VRUIResourceKey.h"
+#include <RE/Skyrim.h>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace vrui
+{
+    /// Bounded cache of loaded NIF roots (the masters widgets clone from).
+    ///
+    /// Replaces the old unbounded map: entries are evicted least-recently-used once the
+    /// entry count or the estimated memory goes over budget. Pinned paths (laser, atlas,
+    /// placeholder meshes) are never evicted and do not count against the budget.
+    /// Evicting a master never affects clones already in the scene. Entries are keyed by
+    /// ResourceKey, so every spelling of a path shares one entry. Main thread only.
+    class VRUIModelCache
+    {
+    public:
+        struct Stats
+        {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t evictions = 0;
+            uint64_t insertions = 0;
+            std::size_t entries = 0;
+            std::size_t pinned = 0;
+            std::size_t bytes = 0;      // Estimated size of every cached master
+            std::size_t peakBytes = 0;
+
+            double hitRate() const { return (hits + misses) ? static_cast<double>(hits) / (hits + misses) : 0.0; }
+        };
+
+        struct CloneStats
+        {
+            uint64_t clones = 0;
+            uint64_t instanced = 0;          // Clones that share their master's materials
+            uint64_t cloneMicros = 0;        // Total time spent cloning (including material rebinding)
+            uint64_t objectBytes = 0;        // Per-instance nodes, geometry objects and shader properties
+            uint64_t materialBytes = 0;      // Per-instance material copies
+            uint64_t sharedMaterials = 0;    // Material copies avoided by sharing
+            uint64_t sharedMaterialBytes = 0;
+            uint64_t overrides = 0;          // Shared materials copied on write (texture / UV flip)
+            uint64_t materialsReleased = 0;  // Shared materials dropped once no instance used them
+            std::size_t liveSharedMaterials = 0;
+        };
+
+        static VRUIModelCache& get();
+
+        /// Master root for `nifPath` (marks it most recently used), or nullptr
+        RE::NiPointer<RE::NiNode> find(std::string_view nifPath);
+
+        /// True if cached (does not count as a lookup or touch the LRU order)
+        bool contains(std::string_view nifPath) const;
+
+        /// Cache `root` as the master for `nifPath`, evicting over budget
+        void insert(std::string_view nifPath, RE::NiPointer<RE::NiNode> root);
+
+        /// Pin or unpin a path. Pins may be set before the model is loaded.
+        void pin(std::string_view nifPath, bool pinned = true);
+
+        /// Budget for unpinned entries (0 = unlimited for that dimension)
+        void setBudget(std::size_t maxEntries, std::size_t maxBytes);
+        std::size_t getMaxEntries() const { return _maxEntries; }
+        std::size_t getMaxBytes() const { return _maxBytes; }
+
+        void clear();
+
+        const Stats& getStats() const { return _stats; }
+
+        /// Log counters and usage (only if there were lookups since the last report)
+        void logStats();
+
+        /// Rough memory held by a model: node/geometry objects plus vertex and index data
+        static std::size_t estimateSize(RE::NiAVObject* root);
+
+        /// New instance of a cached master. Clone() already shares vertex and index buffers;
+        /// with bModelInstancing the clone's shader properties are also pointed at shared
+        /// materials instead of private copies, so only nodes, transforms and properties
+        /// are allocated per instance.
+        RE::NiPointer<RE::NiNode> instantiate(RE::NiNode* master);
+
+        /// Material of `prop` that is safe to modify for this instance only. A shared
+        /// material is replaced by a private copy first (copy-on-write).
+        RE::BSShaderMaterial* makeMaterialUnique(RE::BSGeometry* geom, RE::BSShaderProperty* prop);
+
+        /// Drop shared materials that only the cache still references
+        void releaseUnusedMaterials();
+
+        const CloneStats& getCloneStats() const { return _cloneStats; }
+
+    private:
+        VRUIModelCache() = default;
+
+        struct Entry
+        {
+            ResourceKey key;
+            std::string path;  // First spelling seen (for logs, and to confirm a key hit)
+            RE::NiPointer<RE::NiNode> root;
+            std::size_t bytes = 0;
+            bool pinned = false;
+        };
+
+        /// Entry for `nifPath`, or _index.end() (also when only the hash matches)
+        auto findEntry(std::string_view nifPath) const
+        {
+            auto it = _index.find(ResourceKey(nifPath));
+            return it != _index.end() && ResourceKey::samePath(it->second->path, nifPath) ? it : _index.end();
+        }
+
+        void evictOverBudget();
+        void updateCounts();
+
+        std::list<Entry> _lru;  // Front = most recently used
+        std::unordered_map<ResourceKey, std::list<Entry>::iterator, ResourceKey::Hasher> _index;
+        std::unordered_set<ResourceKey, ResourceKey::Hasher> _pins;
+
+        std::size_t _maxEntries = 256;
+        std::size_t _maxBytes = 64 * 1024 * 1024;
+        std::size_t _unpinnedEntries = 0;
+        std::size_t _unpinnedBytes = 0;
+
+        Stats _stats;
+        uint64_t _lastReportedLookups = 0;
+
+        // Handed out to more than one instance. The reference keeps a material alive while it is
+        // listed, so a freed material's address can never be mistaken for a shared one.
+        std::unordered_map<RE::BSShaderMaterial*, RE::BSTSmartPointer<RE::BSShaderMaterial>> _sharedMaterials;
+        CloneStats _cloneStats;
+        uint64_t _lastReportedClones = 0;
+    };
+}
@@ -0,0 +1,129 @@
+#include "VRUIModelResolver.h"
+#include <RE/B/BSModelDB.h>
+
+namespace vrui
+{
+    namespace
+    {
+        std::string variantPath(const std::string& canonical, int variant)
+        {
+            return variant == 0 ? canonical : "meshes\\" + canonical;
+        }
+
+        /// True if the caller spelled the path with a meshes\ prefix
+        bool hasMeshesPrefix(std::string_view path)
+        {
+            constexpr std::string_view prefix = "meshes";
+            if (path.size() <= prefix.size() || (path[prefix.size()] != '\\' && path[prefix.size()] != '/')) return false;
+            for (std::size_t i = 0; i < prefix.size(); ++i) {
+                char c = path[i];
+                if ((c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c) != prefix[i]) return false;
+            }
+            return true;
+        }
+    }
+
+    VRUIModelResolver& VRUIModelResolver::get()
+    {
+        static VRUIModelResolver instance;
+        return instance;
+    }
+
+    RE::NiPointer<RE::NiNode> VRUIModelResolver::demand(std::string_view nifPath)
+    {
+        ResourceKey key(nifPath);
+
+        // Same order as before: the spelling the caller used first, then the other variant
+        int firstVariant = hasMeshesPrefix(nifPath) ? 1 : 0;
+
+        {
+            std::lock_guard lock(_mutex);
+            _stats.lookups++;
+
+            auto it = _entries.find(key);
+            if (it != _entries.end()) {
+                if (!it->second.found) {
+                    _stats.misses++;
+                    _stats.probesAvoided += kVariantCount;
+                    logger::trace("ImmersiveUI: Model '{}' is known to be missing, not probing", nifPath);
+                    return nullptr;
+                }
+
+                _stats.hits++;
+                if (it->second.variant != firstVariant) {
+                    _stats.probesAvoided++;
+                }
+                firstVariant = it->second.variant;
+            }
+        }
+
+        RE::BSModelDB::DBTraits::ArgsType args{};
+        RE::BSResource::ErrorCode result = RE::BSResource::ErrorCode::kNone;
+        auto canonical = ResourceKey::canonicalize(nifPath);
+
+        // Known variant first; the other one only if it unexpectedly stopped resolving
+        for (int i = 0; i < kVariantCount; ++i) {
+            int variant = (firstVariant + i) % kVariantCount;
+            auto path = variantPath(canonical, variant);
+
+            RE::NiPointer<RE::NiNode> modelRoot;
+            result = RE::BSModelDB::Demand(path.c_str(), modelRoot, args);
+            {
+                std::lock_guard lock(_mutex);
+                _stats.probes++;
+            }
+
+            if (result == RE::BSResource::ErrorCode::kNone && modelRoot) {
+                logger::trace("ImmersiveUI: BSModelDB::Demand success for path: '{}'", path);
+                std::lock_guard lock(_mutex);
+                _entries[key] = Entry{ true, static_cast<uint8_t>(variant) };
+                return modelRoot;
+            }
+        }
+
+        {
+            std::lock_guard lock(_mutex);
+            _entries[key] = Entry{ false, 0 };
+        }
+        logger::warn("ImmersiveUI: BSModelDB::Demand failed for '{}' (tried {} variations, last error={}); not probing it again",
+            nifPath, kVariantCount, static_cast<int>(result));
+        return nullptr;
+    }
+
+    bool VRUIModelResolver::isKnownMissing(std::string_view nifPath) const
+    {
+        ResourceKey key(nifPath);
+        std::lock_guard lock(_mutex);
+        auto it = _entries.find(key);
+        return it != _entries.end() && !it->second.found;
+    }
+
+    void VRUIModelResolver::recordMissing(std::string_view nifPath)
+    {
+        ResourceKey key(nifPath);
+        std::lock_guard lock(_mutex);
+        _entries.try_emplace(key, Entry{ false, 0 });
+    }
+
+    void VRUIModelResolver::clear()
+    {
+        std::lock_guard lock(_mutex);
+        _entries.clear();
+    }
+
+    VRUIModelResolver::Stats VRUIModelResolver::getStats() const
+    {
+        std::lock_guard lock(_mutex);
+        return _stats;
+    }
+
+    void VRUIModelResolver::logStats()
+    {
+        auto stats = getStats();
+        if (stats.lookups == _lastReportedLookups) return;
+        _lastReportedLookups = stats.lookups;
+
+        logger::info("ImmersiveUI: Model resolver: {} lookups ({} known found, {} known missing), {} Demand probes, {} probes avoided",
+            stats.lookups, stats.hits, stats.misses, stats.probes, stats.probesAvoided);
+    }
+}
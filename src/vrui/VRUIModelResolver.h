@@ -0,0 +1,67 @@
+#pragma once
+
+#include "VRUIResourceKey.h"
+#include <RE/Skyrim.h>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace vrui
+{
+    /// Remembers which NIF paths exist and under which spelling.
+    ///
+    /// A path is canonicalized once (see ResourceKey) and probed
+    /// with BSModelDB::Demand under both the plain and the meshes\ variant. The outcome is
+    /// recorded: later requests for a missing path return immediately, and requests for a
+    /// found path go straight to the variant that worked. Thread-safe (the asset loader
+    /// thread resolves through it too).
+    class VRUIModelResolver
+    {
+    public:
+        struct Stats
+        {
+            uint64_t lookups = 0;        // demand() calls
+            uint64_t hits = 0;           // Answered from a recorded "found" (single probe)
+            uint64_t misses = 0;         // Answered from a recorded "missing" (no probe)
+            uint64_t probes = 0;         // BSModelDB::Demand calls made
+            uint64_t probesAvoided = 0;  // Demand calls the unresolved lookup would have made
+        };
+
+        static VRUIModelResolver& get();
+
+        /// Load the model root for `nifPath` (nullptr if no variant exists)
+        RE::NiPointer<RE::NiNode> demand(std::string_view nifPath);
+
+        /// True if `nifPath` was probed before and no variant exists
+        bool isKnownMissing(std::string_view nifPath) const;
+
+        /// Record `nifPath` as missing without probing (it was checked some other way)
+        void recordMissing(std::string_view nifPath);
+
+        /// Forget every recorded outcome (e.g. after data files changed)
+        void clear();
+
+        Stats getStats() const;
+
+        /// Log counters (only if there were lookups since the last report)
+        void logStats();
+
+    private:
+        VRUIModelResolver() = default;
+
+        static constexpr int kVariantCount = 2;  // Plain and meshes\ prefixed
+
+        struct Entry
+        {
+            bool found = false;
+            uint8_t variant = 0;  // Winning variant (0 = plain, 1 = meshes\ prefixed)
+        };
+
+        mutable std::mutex _mutex;
+        std::unordered_map<ResourceKey, Entry, ResourceKey::Hasher> _entries;
+        Stats _stats;
+        uint64_t _lastReportedLookups = 0;
+    };
+}
@@ -1,6 +1,6 @@
 #include "VRUIPanel.h"
 #include "VRUIButton.h"
-#include "VRUISettings.h"
+#include "VRUISettingsStore.h"
 
 namespace vrui
 {
@@ -71,23 +71,19 @@ namespace vrui
         // Apply transforms from settings if correctly attached
         // We rely on the engine's hierarchy since we are attached to the hand node.
         if (_node && _trackingHandNode) {
-            auto& settings = VRUISettings::get();
+            auto& store = VRUISettingsStore::get();
+            const auto& settings = store.frame();
+            const auto& transforms = store.transforms();
             
             // Basic local transform
             _node->local.translate = _offset;
-            
-            RE::NiMatrix3 userRot;
-            userRot.SetEulerAnglesXYZ(
-                settings.menuRotX * (kDegToRad),
-                settings.menuRotY * (kDegToRad),
-                settings.menuRotZ * (kDegToRad)
-            );
-            _node->local.rotate = userRot;
+            _node->local.rotate = transforms.menuRotation;
             _node->local.scale = settings.menuScale;
 
             // --- Update Background ---
             if (settings.showBackground) {
                 if (!_backgroundNode && !_backgroundLoadFailed) {
+                    _backgroundPath = settings.backgroundNifPath;
                     _backgroundNode = VRUIWidget::loadModelFromNif(settings.backgroundNifPath);
                     if (_backgroundNode) {
                         _node->AttachChild(_backgroundNode.get());
@@ -100,11 +96,7 @@ namespace vrui
                 if (_backgroundNode) {
                     _backgroundNode->local.translate = { settings.backgroundOffsetX, settings.backgroundOffsetY, settings.backgroundOffsetZ };
                     _backgroundNode->local.scale = settings.backgroundScale;
-                    _backgroundNode->local.rotate.SetEulerAnglesXYZ(
-                        settings.backgroundRotX * (kDegToRad),
-                        settings.backgroundRotY * (kDegToRad),
-                        settings.backgroundRotZ * (kDegToRad)
-                    );
+                    _backgroundNode->local.rotate = transforms.backgroundRotation;
                 }
             } else if (_backgroundNode) {
                 _node->DetachChild(_backgroundNode.get());
@@ -120,6 +112,18 @@ namespace vrui
         }
     }
 
+    void VRUIPanel::refreshBackground()
+    {
+        if (_backgroundPath == VRUISettingsStore::get().frame().backgroundNifPath) return;
+
+        if (_backgroundNode && _node) {
+            _node->DetachChild(_backgroundNode.get());
+        }
+        _backgroundNode = nullptr;
+        _backgroundLoadFailed = false;
+        _backgroundPath.clear();
+    }
+
     void VRUIPanel::collectButtons(std::vector<VRUIButton*>& outButtons)
     {
         collectButtonsRecursive(this, outButtons);
@@ -17,6 +17,12 @@ namespace vrui
         /// Attach this panel to a specific NiNode in the player skeleton
         void attachToHandNode(RE::NiNode* handNode, const RE::NiPoint3& offset = {0, 5, 10});
 
+        /// Move the panel relative to its hand node (applied on the next update)
+        void setOffset(const RE::NiPoint3& offset) { _offset = offset; }
+
+        /// Drop the background mesh if sBackgroundNifPath changed (update() loads the new one)
+        void refreshBackground();
+
         /// Show/hide the panel (with optional animation)
         virtual void show();
         void hide();
@@ -31,14 +37,34 @@ namespace vrui
         /// Collect all interactive buttons in this panel (recursive)
         void collectButtons(std::vector<VRUIButton*>& outButtons);
 
+        /// Collect every widget of type T in this panel (recursive)
+        template <class T>
+        void collectWidgets(std::vector<T*>& outWidgets)
+        {
+            collectWidgetsRecursive(this, outWidgets);
+        }
+
     private:
         void collectButtonsRecursive(VRUIWidget* widget, std::vector<VRUIButton*>& outButtons);
 
+        template <class T>
+        static void collectWidgetsRecursive(VRUIWidget* widget, std::vector<T*>& outWidgets)
+        {
+            if (!widget) return;
+            if (auto* match = dynamic_cast<T*>(widget)) {
+                outWidgets.push_back(match);
+            }
+            for (auto& child : widget->getChildren()) {
+                collectWidgetsRecursive(child.get(), outWidgets);
+            }
+        }
+
         bool _shown = false;
         bool _active = true;
         bool _backgroundLoadFailed = false;
         RE::NiNode* _trackingHandNode = nullptr;
         RE::NiPointer<RE::NiNode> _backgroundNode;
+        std::string _backgroundPath;  // Path _backgroundNode / _backgroundLoadFailed refer to
         RE::NiPoint3 _offset;
         float _fadeTimer = 0.0f;
         static constexpr float kFadeDuration = 0.2f;
@@ -0,0 +1,132 @@
+#include "VRUIProceduralMesh.h"
+#include "VRUIModelCache.h"
+#include "VRUIWidget.h"
+#include <RE/B/BSDynamicTriShape.h>
+#include <RE/B/BSVisit.h>
+#include <algorithm>
+
+namespace vrui
+{
+    namespace
+    {
+        /// Layout of one entry in BSDynamicTriShape::dynamicData (position + bitangent X in w)
+        struct DynamicVertex
+        {
+            float x;
+            float y;
+            float z;
+            float w;
+        };
+        static_assert(sizeof(DynamicVertex) == 16);
+
+        enum class PoolState : uint8_t
+        {
+            Unknown,
+            Available,
+            Missing
+        };
+
+        PoolState s_poolState = PoolState::Unknown;
+    }
+
+    bool VRUIProceduralMesh::isPoolAvailable()
+    {
+        return s_poolState == PoolState::Available;
+    }
+
+    std::unique_ptr<VRUIProceduralMesh> VRUIProceduralMesh::create(const std::string& name)
+    {
+        if (s_poolState == PoolState::Missing) return nullptr;
+
+        auto root = VRUIWidget::loadModelFromNif(kPoolNifPath);
+        if (!root) {
+            logger::info("ImmersiveUI: Quad pool '{}' not installed, widgets use game meshes", kPoolNifPath);
+            s_poolState = PoolState::Missing;
+            return nullptr;
+        }
+
+        RE::BSDynamicTriShape* shape = nullptr;
+        RE::BSVisit::TraverseScenegraphGeometries(root.get(), [&](RE::BSGeometry* geom) -> RE::BSVisit::BSVisitControl {
+            shape = netimmerse_cast<RE::BSDynamicTriShape*>(geom);
+            if (!shape) return RE::BSVisit::BSVisitControl::kContinue;
+            geom->SetAppCulled(false);
+            return RE::BSVisit::BSVisitControl::kStop;
+        });
+
+        if (!shape) {
+            logger::warn("ImmersiveUI: Quad pool '{}' has no BSDynamicTriShape, widgets use game meshes", kPoolNifPath);
+            s_poolState = PoolState::Missing;
+            return nullptr;
+        }
+
+        auto& dyn = shape->GetDynamicTrishapeRuntimeData();
+        std::size_t vertexCount = dyn.dynamicData ? dyn.dataSize / sizeof(DynamicVertex) : 0;
+        if (vertexCount < kPoolQuads * 4) {
+            logger::warn("ImmersiveUI: Quad pool '{}' has {} vertices, expected {} ({} quads x 4)",
+                kPoolNifPath, vertexCount, kPoolQuads * 4, kPoolQuads);
+            s_poolState = PoolState::Missing;
+            return nullptr;
+        }
+
+        auto mesh = std::unique_ptr<VRUIProceduralMesh>(new VRUIProceduralMesh());
+        mesh->_node = root;
+        mesh->_node->name = name;
+        mesh->_shape = shape;
+
+        s_poolState = PoolState::Available;
+        return mesh;
+    }
+
+    bool VRUIProceduralMesh::setMesh(const MeshData& mesh)
+    {
+        if (!_shape) return false;
+
+        if (mesh.quadCount() > kPoolQuads) {
+            logger::warn("ImmersiveUI: Mesh '{}' has {} quads, only the first {} are drawn",
+                _node->name.c_str(), mesh.quadCount(), kPoolQuads);
+        }
+
+        auto& dyn = _shape->GetDynamicTrishapeRuntimeData();
+        {
+            RE::BSSpinLockGuard guard(dyn.lock);
+            auto* verts = static_cast<DynamicVertex*>(dyn.dynamicData);
+            if (!verts) return false;
+
+            std::size_t capacity = std::min<std::size_t>(dyn.dataSize / sizeof(DynamicVertex), kPoolQuads * 4);
+            std::size_t used = std::min(mesh.vertices.size(), capacity);
+            for (std::size_t i = 0; i < used; ++i) {
+                verts[i].x = mesh.vertices[i].x;
+                verts[i].y = mesh.vertices[i].y;
+                verts[i].z = mesh.vertices[i].z;
+            }
+            // Unused quads collapse to the origin so they rasterize nothing
+            for (std::size_t i = used; i < capacity; ++i) {
+                verts[i].x = 0.0f;
+                verts[i].y = 0.0f;
+                verts[i].z = 0.0f;
+            }
+        }
+
+        if (!mesh.vertices.empty()) {
+            applyColor(mesh.vertices.front().color);
+        }
+        return true;
+    }
+
+    void VRUIProceduralMesh::applyColor(const MeshColor& color)
+    {
+        if (_colorApplied && _color == color) return;
+
+        auto* effect = _shape->GetGeometryRuntimeData().properties[RE::BSGeometry::States::kEffect].get();
+        auto* effectProp = netimmerse_cast<RE::BSEffectShaderProperty*>(effect);
+        if (!effectProp) return;
+
+        // The template is shared between meshes; tint a private copy of its material
+        auto* material = static_cast<RE::BSEffectShaderMaterial*>(VRUIModelCache::get().makeMaterialUnique(_shape, effectProp));
+        if (!material) return;
+
+        material->baseColor = RE::NiColorA{ color.r, color.g, color.b, color.a };
+        _color = color;
+        _colorApplied = true;
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "VRUIMeshBuilder.h"
+#include <RE/Skyrim.h>
+#include <memory>
+#include <string>
+
+namespace vrui
+{
+    /// Procedurally generated widget geometry drawn by a single BSDynamicTriShape.
+    ///
+    /// The shape comes from a quad-pool template NIF (see kPoolNifPath): `kPoolQuads` quads
+    /// whose vertices are consecutive and whose triangles follow MeshData's quad order. After
+    /// the first load the template is a pinned model cache entry, so creating a mesh costs a
+    /// clone and no disk I/O. setMesh() writes MeshData positions into the dynamic vertex
+    /// data in place and collapses the unused quads. The static stream (UVs, vertex colours)
+    /// cannot be rewritten at runtime, so the colour is applied as the effect material's base
+    /// colour (the template is expected to be white, unlit and vertex-alpha).
+    class VRUIProceduralMesh
+    {
+    public:
+        static constexpr const char* kPoolNifPath = "immersiveUI\\shapes\\quadpool.nif";
+        static constexpr std::size_t kPoolQuads = 64;
+
+        /// Create an empty mesh, or nullptr if the pool template is not installed
+        static std::unique_ptr<VRUIProceduralMesh> create(const std::string& name);
+
+        /// True once the template has been found (false after a failed lookup)
+        static bool isPoolAvailable();
+
+        RE::NiNode* getNode() const { return _node.get(); }
+
+        /// Replace the geometry with `mesh`. Quads beyond kPoolQuads are dropped (logged).
+        /// Colour comes from the first vertex.
+        bool setMesh(const MeshData& mesh);
+
+    private:
+        VRUIProceduralMesh() = default;
+
+        void applyColor(const MeshColor& color);
+
+        RE::NiPointer<RE::NiNode> _node;
+        RE::BSDynamicTriShape* _shape = nullptr;
+        MeshColor _color;
+        bool _colorApplied = false;
+    };
+}
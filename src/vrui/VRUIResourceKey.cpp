@@ -0,0 +1,18 @@
+#include "VRUIResourceKey.h"
+
+namespace vrui
+{
+    std::string ResourceKey::canonicalize(std::string_view path)
+    {
+        std::string canonical;
+        canonical.reserve(path.size());
+
+        Reader reader(path);
+        reader.skipPrefixes();
+        char c = 0;
+        while (reader.next(c)) {
+            canonical.push_back(c);
+        }
+        return canonical;
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+// Pure path canonicalization. No game (RE::) dependencies.
+
+#include <cmath>  // CLIBUtil/hash.hpp uses std::floor and std::sqrt without including it
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <CLIBUtil/hash.hpp>
+
+namespace vrui
+{
+    /// 64-bit identity of a mesh or texture path, shared by every asset cache.
+    ///
+    /// Spellings of one file map to the same key: case is ignored, '/' and '\' are the same
+    /// separator (repeats collapse), and a leading "data\" and then "meshes\" or "textures\"
+    /// are stripped. The key is the FNV-1a hash (clib_util::hash) of that canonical form,
+    /// computed in one pass over the original string without building it, so caches can be
+    /// probed with a string_view and no temporary std::string.
+    class ResourceKey
+    {
+    public:
+        constexpr ResourceKey() = default;
+        constexpr explicit ResourceKey(std::string_view path) : _value(hash(path)) {}
+
+        constexpr std::uint64_t value() const { return _value; }
+        constexpr bool empty() const { return _value == 0; }
+
+        constexpr bool operator==(const ResourceKey&) const = default;
+
+        struct Hasher
+        {
+            std::size_t operator()(const ResourceKey& key) const { return static_cast<std::size_t>(key._value); }
+        };
+
+        /// The canonical form itself (for building the paths actually opened, and for logs)
+        static std::string canonicalize(std::string_view path);
+
+        /// True if both paths have the same canonical form. Caches keyed by ResourceKey call
+        /// this on a hit so that two paths whose hashes collide never share an entry.
+        static constexpr bool samePath(std::string_view a, std::string_view b)
+        {
+            Reader left(a);
+            Reader right(b);
+            left.skipPrefixes();
+            right.skipPrefixes();
+            char l = 0;
+            char r = 0;
+            for (;;) {
+                bool hasLeft = left.next(l);
+                if (hasLeft != right.next(r)) return false;
+                if (!hasLeft) return true;
+                if (l != r) return false;
+            }
+        }
+
+        /// FNV-1a of canonicalize(path), without allocating (0 for an empty path)
+        static constexpr std::uint64_t hash(std::string_view path)
+        {
+            Reader reader(path);
+            reader.skipPrefixes();
+            if (reader.atEnd()) return 0;
+
+            // Same constants as clib_util::hash::fnv1a_64
+            std::uint64_t value = clib_util::hash::fnv1a_64(std::string_view{});
+            constexpr std::uint64_t prime = 0x00000100000001B3;
+            char c = 0;
+            while (reader.next(c)) {
+                value ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+                value *= prime;
+            }
+            return value;
+        }
+
+    private:
+        /// Yields the canonical characters of a path one at a time
+        class Reader
+        {
+        public:
+            constexpr explicit Reader(std::string_view path) : _path(path) {}
+
+            constexpr bool atEnd() const
+            {
+                Reader copy = *this;
+                char c = 0;
+                return !copy.next(c);
+            }
+
+            constexpr bool next(char& out)
+            {
+                while (_pos < _path.size()) {
+                    char c = fold(_path[_pos++]);
+                    // Collapse repeated separators, and drop leading ones
+                    if (c == '\\' && (_last == '\\' || _last == 0)) continue;
+                    _last = c;
+                    out = c;
+                    return true;
+                }
+                return false;
+            }
+
+            constexpr void skipPrefixes()
+            {
+                skip("data\\");
+                if (!skip("meshes\\")) skip("textures\\");
+            }
+
+        private:
+            static constexpr char fold(char c)
+            {
+                if (c == '/') return '\\';
+                return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+            }
+
+            constexpr bool skip(std::string_view prefix)
+            {
+                Reader copy = *this;
+                for (char expected : prefix) {
+                    char c = 0;
+                    if (!copy.next(c) || c != expected) return false;
+                }
+                *this = copy;
+                return true;
+            }
+
+            std::string_view _path;
+            std::size_t _pos = 0;
+            char _last = 0;
+        };
+
+        std::uint64_t _value = 0;
+    };
+
+    static_assert(ResourceKey::samePath("Data/Meshes/ImmersiveUI//IconPlane.nif", "immersiveUI\\iconplane.nif"));
+    static_assert(!ResourceKey::samePath("immersiveUI\\a.nif", "immersiveUI\\ab.nif"));
+}
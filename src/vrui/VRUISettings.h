@@ -1,10 +1,12 @@
 #pragma once
 
+#include "VRUISlotTable.h"
 #include <string>
 
 namespace vrui
 {
-    /// Configuration settings loaded from ImmersiveUI.ini
+    /// Configuration settings loaded from ImmersiveUI.ini.
+    /// The INI keys, ranges and comments of these members are listed in VRUISettingsSchema.cpp.
     struct VRUISettings
     {
         // --- Activation ---
@@ -14,6 +16,13 @@ namespace vrui
 
         // --- Visual ---
         bool verboseLogging = false;        // Enable trace-level logging (very spammy, for debugging only)
+        bool asyncAssetLoading = true;      // Load menu NIFs on a background thread (placeholders until ready)
+        float assetSwapBudgetMs = 1.0f;     // Main-thread time per frame for swapping loaded meshes in
+        int modelCacheMaxEntries = 256;     // Loaded NIFs kept for cloning (0 = unlimited); pinned ones don't count
+        float modelCacheBudgetMB = 64.0f;   // Estimated memory budget for those NIFs (0 = unlimited)
+        bool modelInstancing = true;        // Clones share their master's materials (copied only when overridden)
+        bool watchConfigFile = true;        // Pick up INI edits while the game runs (watcher thread)
+        std::string activeProfile;          // Settings profile applied over this file (empty = none)
         float menuScale = 0.8f;               // Overall menu scale
         float menuOffsetX = 0.0f;              // Menu offset from hand (X)
         float menuOffsetY = 10.5f;             // Menu offset from hand (Y = forward)
@@ -67,26 +76,33 @@ namespace vrui
         float hapticDuration = 0.04f;          // Haptic pulse duration in seconds (40ms)
         bool debugMode = false;                // Show debug info (raycast line, AABB boxes)
         
-        // --- Slots (4 Pages of 9 = 36 Slots) ---
-        std::string slotActions[36] = {
-            "Save", "Wait", "TweenMenu",
-            "Inventory", "Magic", "Map",
-            "Journal", "None", "NextPage", // Page 1
-            "None", "None", "None", "None", "None", "None", "None", "None", "NextPage", // Page 2
-            "None", "None", "None", "None", "None", "None", "None", "None", "NextPage", // Page 3
-            "None", "None", "None", "None", "None", "None", "None", "None", "NextPage"  // Page 4
-        };
-        std::string slotTextures[36]; // Custom icons
-        std::string slotNifs[36];     // Optional custom NIFs per slot
-        std::string slotLabels[36];   // 3D labels per slot
-        std::string slotSublabels[36]; // 3D sublabels per slot
+        // --- Slots (pages of 9, as many as the last configured slot needs) ---
+        VRUISlotTable slots = VRUISlotTable::defaults();
         
-        /// Load settings from INI file
+        /// Load settings from INI file over the current values (defaults, normally). Uses the
+        /// binary cache next to it when the INI bytes are unchanged (see VRUISettingsCache).
         void load(const std::string& iniPath);
 
-        /// Save current settings to INI file
+        /// Save current settings to INI file, synchronously (see VRUISettingsWriter for the
+        /// background writer the MCM uses)
         void save(const std::string& iniPath) const;
 
+        /// The full INI document for these settings
+        std::string serialize() const;
+
+        /// INI document of only the keys that differ from `base`: a profile overlay
+        /// (see VRUISettingsProfiles). sProfile is never written.
+        std::string serializeOverlay(const VRUISettings& base) const;
+
+        /// Clamp every numeric setting into its schema range (logs what was changed)
+        void validate();
+
+        /// NIF for slot `i`: sSlotXXNif if set, otherwise immersiveUI\slotXX.nif
+        std::string slotNifPath(int i) const;
+
+        /// Texture for slot `i`: sSlotXXImage if set, otherwise the placeholder icon
+        std::string slotTexturePath(int i) const;
+
         /// Get default INI file path (Data/SKSE/Plugins/ImmersiveUI.ini)
         static std::string getDefaultIniPath();
 
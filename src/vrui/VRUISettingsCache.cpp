@@ -0,0 +1,265 @@
+#include "VRUISettingsCache.h"
+#include "VRUISettingsSchema.h"
+#include "VRUISettingsWriter.h"
+#include "VRUIMappedFile.h"
+#include <cstring>
+#include <filesystem>
+
+namespace vrui
+{
+    namespace
+    {
+        constexpr char kMagic[4] = { 'I', 'U', 'I', 'C' };
+        constexpr uint32_t kFormatVersion = 1;
+
+        struct Header
+        {
+            char magic[4];
+            uint32_t formatVersion;
+            uint64_t schemaHash;
+            uint64_t sourceHash;
+            uint64_t payloadHash;
+            uint64_t payloadSize;
+        };
+        static_assert(sizeof(Header) == 40);
+
+        template <class T>
+        uint64_t hashValue(const T& value, uint64_t seed)
+        {
+            return VRUISettingsCache::hashSource({ reinterpret_cast<const char*>(&value), sizeof(T) }, seed);
+        }
+
+        /// Changes whenever a field is added, removed, renamed or retyped, or a default or
+        /// range changes, so caches written by another build of the plugin are never decoded
+        /// with the wrong layout and never bring back values that build would not produce
+        uint64_t schemaHash()
+        {
+            static const uint64_t hash = []() {
+                uint64_t result = VRUISettingsCache::kHashSeed;
+                for (const auto& field : settingsSchema()) {
+                    result = VRUISettingsCache::hashSource(field.section, result);
+                    result = VRUISettingsCache::hashSource(field.key, result);
+                    result = hashValue(field.type, result);
+                    result = hashValue(field.minValue, result);
+                    result = hashValue(field.maxValue, result);
+                }
+                return VRUISettingsCache::hashSource(VRUISettingsCache::encode(defaultSettings()), result);
+            }();
+            return hash;
+        }
+
+        class Encoder
+        {
+        public:
+            template <class T>
+            void put(const T& value)
+            {
+                _out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+            }
+
+            void putString(const std::string& value)
+            {
+                put(static_cast<uint32_t>(value.size()));
+                _out.append(value);
+            }
+
+            std::string take() { return std::move(_out); }
+
+        private:
+            std::string _out;
+        };
+
+        class Decoder
+        {
+        public:
+            explicit Decoder(std::string_view in) : _in(in) {}
+
+            template <class T>
+            bool get(T& value)
+            {
+                if (_in.size() < sizeof(T)) return false;
+                std::memcpy(&value, _in.data(), sizeof(T));
+                _in.remove_prefix(sizeof(T));
+                return true;
+            }
+
+            bool getString(std::string_view& value)
+            {
+                uint32_t size = 0;
+                if (!get(size) || _in.size() < size) return false;
+                value = _in.substr(0, size);
+                _in.remove_prefix(size);
+                return true;
+            }
+
+            bool atEnd() const { return _in.empty(); }
+
+        private:
+            std::string_view _in;
+        };
+    }
+
+    uint64_t VRUISettingsCache::hashSource(std::string_view bytes, uint64_t seed)
+    {
+        constexpr uint64_t kPrime = 1099511628211ull;
+
+        // FNV-1a over 8-byte words (the tail byte by byte): same quality for change
+        // detection, about eight times fewer dependent multiplies than per byte
+        uint64_t hash = seed;
+        while (bytes.size() >= sizeof(uint64_t)) {
+            uint64_t word = 0;
+            std::memcpy(&word, bytes.data(), sizeof(word));
+            hash = (hash ^ word) * kPrime;
+            hash ^= hash >> 32;
+            bytes.remove_prefix(sizeof(word));
+        }
+        for (char c : bytes) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * kPrime;
+        }
+        return hash;
+    }
+
+    std::string VRUISettingsCache::pathFor(const std::string& iniPath)
+    {
+        return std::filesystem::path(iniPath).replace_extension(".cache").string();
+    }
+
+    std::string VRUISettingsCache::encode(const VRUISettings& settings)
+    {
+        Encoder out;
+        const auto schema = settingsSchema();
+        for (const auto& field : schema) {
+            switch (field.type) {
+            case SettingField::Type::Bool:
+                out.put(static_cast<uint8_t>(settings.*field.boolMember));
+                break;
+            case SettingField::Type::Int:
+                out.put(static_cast<int32_t>(settings.*field.intMember));
+                break;
+            case SettingField::Type::Float:
+                out.put(settings.*field.floatMember);
+                break;
+            case SettingField::Type::String:
+                out.putString(settings.*field.stringMember);
+                break;
+            case SettingField::Type::SlotStrings:
+                break;  // Per slot below
+            }
+        }
+
+        // Configured slots only: index, then each slot field in schema order
+        const auto& entries = settings.slots.entries();
+        out.put(static_cast<uint32_t>(entries.size()));
+        for (const auto& entry : entries) {
+            out.put(static_cast<int32_t>(entry.index));
+            for (const auto& field : schema) {
+                if (field.type == SettingField::Type::SlotStrings) {
+                    out.putString(entry.config.*field.slotMember);
+                }
+            }
+        }
+        return out.take();
+    }
+
+    bool VRUISettingsCache::decode(std::string_view payload, VRUISettings& settings)
+    {
+        // Decoded into a copy so a damaged payload leaves `settings` untouched
+        VRUISettings decoded = settings;
+        Decoder in(payload);
+        const auto schema = settingsSchema();
+
+        for (const auto& field : schema) {
+            switch (field.type) {
+            case SettingField::Type::Bool: {
+                uint8_t value = 0;
+                if (!in.get(value)) return false;
+                decoded.*field.boolMember = value != 0;
+                break;
+            }
+            case SettingField::Type::Int: {
+                int32_t value = 0;
+                if (!in.get(value)) return false;
+                decoded.*field.intMember = value;
+                break;
+            }
+            case SettingField::Type::Float:
+                if (!in.get(decoded.*field.floatMember)) return false;
+                break;
+            case SettingField::Type::String: {
+                std::string_view value;
+                if (!in.getString(value)) return false;
+                (decoded.*field.stringMember).assign(value);
+                break;
+            }
+            case SettingField::Type::SlotStrings:
+                break;
+            }
+        }
+
+        uint32_t count = 0;
+        if (!in.get(count) || count > static_cast<uint32_t>(VRUISlotTable::kMaxSlots)) return false;
+
+        decoded.slots = VRUISlotTable{};
+        for (uint32_t i = 0; i < count; ++i) {
+            int32_t index = 0;
+            if (!in.get(index)) return false;
+
+            SlotConfig slot;
+            for (const auto& field : schema) {
+                if (field.type != SettingField::Type::SlotStrings) continue;
+                std::string_view value;
+                if (!in.getString(value)) return false;
+                (slot.*field.slotMember).assign(value);
+            }
+            decoded.slots.put(index, std::move(slot));  // Written in index order: appends
+        }
+
+        if (!in.atEnd()) return false;
+        settings = std::move(decoded);
+        return true;
+    }
+
+    bool VRUISettingsCache::load(const std::string& cachePath, uint64_t sourceHash, VRUISettings& settings)
+    {
+        VRUIMappedFile file;
+        if (!file.open(cachePath)) return false;
+
+        auto data = file.view();
+        Header header{};
+        if (data.size() < sizeof(Header)) return false;
+        std::memcpy(&header, data.data(), sizeof(Header));
+        data.remove_prefix(sizeof(Header));
+
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.formatVersion != kFormatVersion) return false;
+        if (header.schemaHash != schemaHash() || header.sourceHash != sourceHash) return false;
+        if (header.payloadSize != data.size() || header.payloadHash != hashSource(data)) {
+            logger::warn("ImmersiveUI: Settings cache '{}' is damaged, ignoring it", cachePath);
+            return false;
+        }
+
+        return decode(data, settings);
+    }
+
+    bool VRUISettingsCache::save(const std::string& cachePath, uint64_t sourceHash, const VRUISettings& settings)
+    {
+        auto payload = encode(settings);
+
+        Header header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.formatVersion = kFormatVersion;
+        header.schemaHash = schemaHash();
+        header.sourceHash = sourceHash;
+        header.payloadHash = hashSource(payload);
+        header.payloadSize = payload.size();
+
+        std::string text(reinterpret_cast<const char*>(&header), sizeof(Header));
+        text += payload;
+
+        auto error = VRUISettingsWriter::writeFileAtomic(cachePath, text);
+        if (!error.empty()) {
+            logger::warn("ImmersiveUI: Could not write settings cache '{}': {}", cachePath, error);
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "VRUISettings.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace vrui
+{
+    /// Binary copy of fully resolved (parsed and validated) settings, keyed by the sources.
+    ///
+    /// The file holds a fixed header (magic, format version, a hash of the schema with its
+    /// defaults and ranges, the hash of the sources it was built from, payload size and
+    /// hash), then every schema field in order and the configured slots. load() maps it,
+    /// checks the header against the current schema and sources and decodes it without
+    /// touching the INI parser; any mismatch or damage makes it return false so the caller
+    /// parses instead. Sources are hashed with hashSource(); chain the seed to key on
+    /// several files and on the settings the files are applied over.
+    class VRUISettingsCache
+    {
+    public:
+        static constexpr uint64_t kHashSeed = 14695981039346656037ull;
+
+        /// Hash of `bytes` (word-wise FNV-1a), continuing from `seed`
+        static uint64_t hashSource(std::string_view bytes, uint64_t seed = kHashSeed);
+
+        /// Fill `settings` from the cache at `cachePath` if it was built from `sourceHash`
+        static bool load(const std::string& cachePath, uint64_t sourceHash, VRUISettings& settings);
+
+        /// Write `settings` as the cache for `sourceHash` (temporary file and rename). Returns false on error.
+        static bool save(const std::string& cachePath, uint64_t sourceHash, const VRUISettings& settings);
+
+        /// Cache file next to `iniPath` ("ImmersiveUI.ini" -> "ImmersiveUI.cache")
+        static std::string pathFor(const std::string& iniPath);
+
+        /// Encoded payload (fields and slots, without the header)
+        static std::string encode(const VRUISettings& settings);
+
+        /// Decode a payload from encode(); false if it is truncated or malformed
+        static bool decode(std::string_view payload, VRUISettings& settings);
+    };
+}
@@ -0,0 +1,125 @@
+#include "VRUISettingsProfiles.h"
+#include "VRUIIniReader.h"
+#include "VRUIMappedFile.h"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+
+namespace vrui
+{
+    namespace
+    {
+        const std::string kBaseName;
+    }
+
+    VRUISettingsProfiles& VRUISettingsProfiles::get()
+    {
+        static VRUISettingsProfiles instance;
+        return instance;
+    }
+
+    std::string VRUISettingsProfiles::directoryFor(const std::string& iniPath)
+    {
+        auto ini = std::filesystem::path(iniPath);
+        return (ini.parent_path() / ini.stem() / "Profiles").string();
+    }
+
+    std::string VRUISettingsProfiles::pathFor(std::string_view name) const
+    {
+        return (std::filesystem::path(_directory) / (std::string(name) + ".ini")).string();
+    }
+
+    std::string VRUISettingsProfiles::lowercase(std::string_view text)
+    {
+        std::string result(text);
+        std::transform(result.begin(), result.end(), result.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return result;
+    }
+
+    void VRUISettingsProfiles::load(const std::string& directory, const VRUISettings& base)
+    {
+        _directory = directory;
+        _profiles.clear();
+        _byName.clear();
+
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+            const auto& path = entry.path();
+            if (!entry.is_regular_file(ec) || lowercase(path.extension().string()) != ".ini") continue;
+
+            VRUIMappedFile file;
+            if (!file.open(path.string())) {
+                logger::warn("ImmersiveUI: Cannot read settings profile '{}'", path.string());
+                continue;
+            }
+            _profiles.push_back(Profile{ path.stem().string(), std::string(file.view()), {} });
+        }
+
+        std::sort(_profiles.begin(), _profiles.end(),
+            [](const Profile& a, const Profile& b) { return lowercase(a.name) < lowercase(b.name); });
+        for (std::size_t i = 0; i < _profiles.size(); ++i) {
+            _byName[lowercase(_profiles[i].name)] = i;
+        }
+        rebase(base);
+
+        if (!_profiles.empty()) {
+            logger::info("ImmersiveUI: Loaded {} settings profiles from '{}'", _profiles.size(), directory);
+        }
+    }
+
+    void VRUISettingsProfiles::rebase(const VRUISettings& base)
+    {
+        _base = base;
+        _iniProfile = std::move(_base.activeProfile);
+        _base.activeProfile.clear();
+        for (auto& profile : _profiles) {
+            profile.settings = resolve(profile);
+        }
+    }
+
+    VRUISettings VRUISettingsProfiles::resolve(const Profile& profile) const
+    {
+        VRUISettings settings = _base;
+        auto result = VRUIIniReader::parse(profile.overlay, settings);
+        if (result.invalid > 0 || result.unknown > 0) {
+            logger::warn("ImmersiveUI: Settings profile '{}': {} unknown and {} invalid keys ignored",
+                profile.name, result.unknown, result.invalid);
+        }
+        settings.validate();
+        settings.activeProfile = profile.name;
+        return settings;
+    }
+
+    const VRUISettings* VRUISettingsProfiles::find(std::string_view name) const
+    {
+        if (name.empty()) return &_base;
+        auto it = _byName.find(lowercase(name));
+        return it != _byName.end() ? &_profiles[it->second].settings : nullptr;
+    }
+
+    void VRUISettingsProfiles::reload(std::string_view name)
+    {
+        auto it = _byName.find(lowercase(name));
+        if (it == _byName.end()) return;
+
+        auto& profile = _profiles[it->second];
+        VRUIMappedFile file;
+        if (!file.open(pathFor(profile.name))) {
+            logger::warn("ImmersiveUI: Cannot read settings profile '{}'", pathFor(profile.name));
+            return;
+        }
+        profile.overlay.assign(file.view());
+        profile.settings = resolve(profile);
+    }
+
+    const std::string& VRUISettingsProfiles::next(std::string_view current) const
+    {
+        if (_profiles.empty()) return kBaseName;
+        if (current.empty()) return _profiles.front().name;
+
+        auto it = _byName.find(lowercase(current));
+        if (it == _byName.end() || it->second + 1 >= _profiles.size()) return kBaseName;
+        return _profiles[it->second + 1].name;
+    }
+}
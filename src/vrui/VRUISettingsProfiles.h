@@ -0,0 +1,73 @@
+#pragma once
+
+#include "VRUISettings.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace vrui
+{
+    /// Named settings profiles (seated/standing, left/right-handed, ...), held in memory.
+    ///
+    /// A profile is an INI in the profile directory (Data/SKSE/Plugins/ImmersiveUI/Profiles/
+    /// <Name>.ini) holding only the keys it changes; they are applied over ImmersiveUI.ini.
+    /// Every profile is read and resolved once at startup (and re-resolved from the kept
+    /// text when ImmersiveUI.ini reloads), so switching is a hash lookup that hands back a
+    /// complete VRUISettings; VRMenuManager::setProfile then diffs it against the live
+    /// settings and rebuilds only what differs. The empty name is ImmersiveUI.ini itself.
+    class VRUISettingsProfiles
+    {
+    public:
+        static VRUISettingsProfiles& get();
+
+        /// Read every *.ini in `directory` and resolve it over `base`. Main thread.
+        void load(const std::string& directory, const VRUISettings& base);
+
+        /// Re-resolve every profile over a reloaded ImmersiveUI.ini (no file access)
+        void rebase(const VRUISettings& base);
+
+        /// `name` resolved over the base (case-insensitive; "" = the base), or nullptr if unknown
+        const VRUISettings* find(std::string_view name) const;
+
+        /// Re-read profile `name` from its file and resolve it again (after the MCM saved it)
+        void reload(std::string_view name);
+
+        std::size_t count() const { return _profiles.size(); }
+        const std::string& nameAt(std::size_t index) const { return _profiles[index].name; }
+
+        /// Profile after `current` in name order, wrapping through the base ("")
+        const std::string& next(std::string_view current) const;
+
+        /// sProfile of ImmersiveUI.ini: the profile to start with
+        const std::string& iniProfile() const { return _iniProfile; }
+
+        /// File of profile `name` in the profile directory
+        std::string pathFor(std::string_view name) const;
+
+        /// Profile directory for `iniPath` (Data/SKSE/Plugins/ImmersiveUI/Profiles)
+        static std::string directoryFor(const std::string& iniPath);
+
+    private:
+        VRUISettingsProfiles() = default;
+
+        struct Profile
+        {
+            std::string name;     // As the file is named
+            std::string overlay;  // The profile's INI text
+            VRUISettings settings;
+        };
+
+        /// `overlay` applied over the base and validated
+        VRUISettings resolve(const Profile& profile) const;
+
+        static std::string lowercase(std::string_view text);
+
+        std::string _directory;
+        std::string _iniProfile;
+        VRUISettings _base;  // ImmersiveUI.ini with sProfile cleared
+        std::vector<Profile> _profiles;  // Sorted by name
+        std::unordered_map<std::string, std::size_t> _byName;  // Lowercase name -> index
+    };
+}
@@ -0,0 +1,279 @@
+#include "VRUISettingsSchema.h"
+#include <algorithm>
+#include <cstring>
+
+namespace vrui
+{
+    namespace
+    {
+        using Type = SettingField::Type;
+        using Inv = SettingsInvalidation;
+
+        constexpr SettingField boolField(const char* section, const char* key, bool VRUISettings::*member,
+                                         Inv invalidates, const char* comment = nullptr, const char* label = nullptr)
+        {
+            SettingField field;
+            field.section = section;
+            field.key = key;
+            field.type = Type::Bool;
+            field.boolMember = member;
+            field.invalidates = invalidates;
+            field.comment = comment;
+            field.label = label;
+            return field;
+        }
+
+        constexpr SettingField intField(const char* section, const char* key, int VRUISettings::*member,
+                                        int minValue, int maxValue, Inv invalidates, const char* comment = nullptr)
+        {
+            SettingField field;
+            field.section = section;
+            field.key = key;
+            field.type = Type::Int;
+            field.intMember = member;
+            field.minValue = static_cast<float>(minValue);
+            field.maxValue = static_cast<float>(maxValue);
+            field.step = 1.0f;
+            field.invalidates = invalidates;
+            field.comment = comment;
+            return field;
+        }
+
+        constexpr SettingField floatField(const char* section, const char* key, float VRUISettings::*member,
+                                          float minValue, float maxValue, Inv invalidates, const char* comment = nullptr,
+                                          const char* label = nullptr, float step = 0.0f)
+        {
+            SettingField field;
+            field.section = section;
+            field.key = key;
+            field.type = Type::Float;
+            field.floatMember = member;
+            field.minValue = minValue;
+            field.maxValue = maxValue;
+            field.step = step;
+            field.invalidates = invalidates;
+            field.comment = comment;
+            field.label = label;
+            return field;
+        }
+
+        constexpr SettingField stringField(const char* section, const char* key, std::string VRUISettings::*member,
+                                           Inv invalidates, const char* comment = nullptr)
+        {
+            SettingField field;
+            field.section = section;
+            field.key = key;
+            field.type = Type::String;
+            field.stringMember = member;
+            field.invalidates = invalidates;
+            field.comment = comment;
+            return field;
+        }
+
+        constexpr SettingField slotField(const char* suffix, std::string SlotConfig::*member,
+                                         Inv invalidates, const char* comment = nullptr)
+        {
+            SettingField field;
+            field.section = "Slots";
+            field.key = suffix;
+            field.type = Type::SlotStrings;
+            field.slotMember = member;
+            field.invalidates = invalidates;
+            field.comment = comment;
+            return field;
+        }
+
+        constexpr float kUnbounded = 1.0e9f;
+        constexpr float kAngle = 360.0f;
+        constexpr float kOffset = 100.0f;
+
+        // clang-format off
+        constexpr SettingField kFields[] = {
+            // Activation
+            floatField("Activation", "fHoldTime", &VRUISettings::activationHoldTime, 0.0f, 10.0f, Inv::PerFrame,
+                "Seconds to hold the activation button to toggle menu (default: 2.0)"),
+            boolField("Activation", "bUseLeftHandAsMenu", &VRUISettings::useLeftHandAsMenu, Inv::Layout,
+                "true = menu on left hand (dominant right), false = menu on right hand"),
+            intField("Activation", "iActivationButton", &VRUISettings::activationButton, 0, 3, Inv::PerFrame,
+                "0=Grip, 1=Trigger, 2=Grip(default), 3=Thumbstick Press"),
+
+            // General
+            boolField("General", "bVerboseLogging", &VRUISettings::verboseLogging, Inv::Logging,
+                "Enable trace-level logging for debugging (default: false, very spammy)"),
+            boolField("General", "bAsyncAssetLoading", &VRUISettings::asyncAssetLoading, Inv::PerFrame,
+                "Load menu meshes in the background and show placeholders until they are ready (default: true)"),
+            floatField("General", "fAssetSwapBudgetMs", &VRUISettings::assetSwapBudgetMs, 0.05f, 50.0f, Inv::PerFrame,
+                "Milliseconds per frame spent swapping loaded meshes into the menu (default: 1.0)"),
+            intField("General", "iModelCacheMaxEntries", &VRUISettings::modelCacheMaxEntries, 0, 1000000, Inv::Assets,
+                "Loaded meshes kept in memory for reuse, least recently used dropped first (default: 256, 0 = unlimited)"),
+            floatField("General", "fModelCacheBudgetMB", &VRUISettings::modelCacheBudgetMB, 0.0f, 65536.0f, Inv::Assets,
+                "Estimated memory budget for those meshes in MB (default: 64, 0 = unlimited)"),
+            boolField("General", "bModelInstancing", &VRUISettings::modelInstancing, Inv::Assets,
+                "Repeated meshes share materials instead of copying them per button (default: true)"),
+            stringField("General", "sProfile", &VRUISettings::activeProfile, Inv::None,
+                "Settings profile to start with: a file in ImmersiveUI/Profiles, without .ini (empty = none)"),
+            boolField("General", "bWatchConfigFile", &VRUISettings::watchConfigFile, Inv::PerFrame,
+                "Apply edits to this file while the game is running (default: true)"),
+
+            // Visual
+            floatField("Visual", "fMenuScale", &VRUISettings::menuScale, 0.05f, 10.0f, Inv::Transform,
+                "Overall scale of the menu panel", "Menu Scale", 0.05f),
+            floatField("Visual", "fMenuOffsetX", &VRUISettings::menuOffsetX, -kOffset, kOffset, Inv::Transform,
+                "Menu offset X (right/left)"),
+            floatField("Visual", "fMenuOffsetY", &VRUISettings::menuOffsetY, -kOffset, kOffset, Inv::Transform,
+                "Menu offset Y (forward)", "Pos Y (Forward)", 0.5f),
+            floatField("Visual", "fMenuOffsetZ", &VRUISettings::menuOffsetZ, -kOffset, kOffset, Inv::Transform,
+                "Menu offset Z (up)", "Pos Z (Up)", 0.5f),
+            floatField("Visual", "fMenuRotX", &VRUISettings::menuRotX, -kAngle, kAngle, Inv::Transform,
+                "Menu rotation X (pitch)", "Rot X (Pitch)", 5.0f),
+            floatField("Visual", "fMenuRotY", &VRUISettings::menuRotY, -kAngle, kAngle, Inv::Transform,
+                "Menu rotation Y (roll)", "Rot Y (Roll)", 5.0f),
+            floatField("Visual", "fMenuRotZ", &VRUISettings::menuRotZ, -kAngle, kAngle, Inv::Transform,
+                "Menu rotation Z (yaw)", "Rot Z (Yaw)", 5.0f),
+            floatField("Visual", "fTouchOffsetX", &VRUISettings::touchOffsetX, -kOffset, kOffset, Inv::PerFrame,
+                "Touch point offset X (Right/Left)"),
+            floatField("Visual", "fTouchOffsetY", &VRUISettings::touchOffsetY, -kOffset, kOffset, Inv::PerFrame,
+                "Touch point offset Y (Forward/Backward)"),
+            floatField("Visual", "fTouchOffsetZ", &VRUISettings::touchOffsetZ, -kOffset, kOffset, Inv::PerFrame,
+                "Touch point offset Z (Push from wrist to fingertips)"),
+            floatField("Visual", "fButtonSpacing", &VRUISettings::buttonSpacing, 0.0f, 50.0f, Inv::Layout,
+                "Spacing between buttons", "Button Spacing", 0.1f),
+            floatField("Visual", "fButtonMeshScale", &VRUISettings::buttonMeshScale, 0.0001f, 10.0f, Inv::MeshTransform | Inv::Layout,
+                "Scale of the button mesh (default 0.02 is for 100x100 meshes like IconPlane)"),
+            floatField("Visual", "fButtonMeshRotX", &VRUISettings::buttonMeshRotX, -kAngle, kAngle, Inv::MeshTransform,
+                "Individual button mesh rotation X"),
+            floatField("Visual", "fButtonMeshRotY", &VRUISettings::buttonMeshRotY, -kAngle, kAngle, Inv::MeshTransform,
+                "Individual button mesh rotation Y"),
+            floatField("Visual", "fButtonMeshRotZ", &VRUISettings::buttonMeshRotZ, -kAngle, kAngle, Inv::MeshTransform,
+                "Individual button mesh rotation Z"),
+            boolField("Visual", "bFlipTextureH", &VRUISettings::flipTextureH, Inv::Meshes,
+                "Flip icons horizontally (useful if you rotate the mesh 180 degrees)"),
+            boolField("Visual", "bFlipTextureV", &VRUISettings::flipTextureV, Inv::Meshes,
+                "Flip icons vertically"),
+            boolField("Visual", "bInvertGridX", &VRUISettings::invertGridX, Inv::Layout,
+                "Invert grid columns (Horizontal flip of the layout)"),
+            boolField("Visual", "bShowBackground", &VRUISettings::showBackground, Inv::PerFrame,
+                "Show background plane"),
+            floatField("Visual", "fBackgroundScale", &VRUISettings::backgroundScale, 0.0001f, 10.0f, Inv::PerFrame,
+                "Scale of the background plane"),
+            floatField("Visual", "fBackgroundOffsetX", &VRUISettings::backgroundOffsetX, -kOffset, kOffset, Inv::PerFrame),
+            floatField("Visual", "fBackgroundOffsetY", &VRUISettings::backgroundOffsetY, -kOffset, kOffset, Inv::PerFrame),
+            floatField("Visual", "fBackgroundOffsetZ", &VRUISettings::backgroundOffsetZ, -kOffset, kOffset, Inv::PerFrame),
+            floatField("Visual", "fBackgroundRotX", &VRUISettings::backgroundRotX, -kAngle, kAngle, Inv::PerFrame),
+            floatField("Visual", "fBackgroundRotY", &VRUISettings::backgroundRotY, -kAngle, kAngle, Inv::PerFrame),
+            floatField("Visual", "fBackgroundRotZ", &VRUISettings::backgroundRotZ, -kAngle, kAngle, Inv::PerFrame),
+
+            // Interaction
+            floatField("Interaction", "fRaycastMaxDistance", &VRUISettings::raycastMaxDistance, 1.0f, 100000.0f, Inv::PerFrame,
+                "Maximum range of the interaction laser pointer"),
+            stringField("Interaction", "sLaserNifPath", &VRUISettings::laserNifPath, Inv::Meshes,
+                "Path to custom laser NIF"),
+            stringField("Interaction", "sBackgroundNifPath", &VRUISettings::backgroundNifPath, Inv::Meshes,
+                "Path to custom background NIF"),
+            boolField("Interaction", "bHapticOnHover", &VRUISettings::hapticOnHover, Inv::PerFrame,
+                "Haptic pulse on button hover"),
+            boolField("Interaction", "bHapticOnPress", &VRUISettings::hapticOnPress, Inv::PerFrame,
+                "Haptic pulse on button press"),
+            floatField("Interaction", "fHapticIntensity", &VRUISettings::hapticIntensity, 0.0f, 1.0f, Inv::PerFrame,
+                "Haptic strength (0-1)"),
+            floatField("Interaction", "fHapticDuration", &VRUISettings::hapticDuration, 0.0f, 2.0f, Inv::PerFrame,
+                "Haptic pulse duration in seconds"),
+            floatField("Interaction", "fHitboxScale", &VRUISettings::hitboxScale, 0.01f, 100.0f, Inv::PerFrame,
+                "Multiplier for hitbox width/height (1.0 = exact mesh size)"),
+            floatField("Interaction", "fHitTestDepth", &VRUISettings::hitTestDepth, 0.0f, 100.0f, Inv::PerFrame,
+                "Depth (thickness) of the button's selection volume"),
+
+            // Labels
+            floatField("Labels", "fLabelScale", &VRUISettings::labelScale, 0.001f, 100.0f, Inv::Labels,
+                "Scale of characters"),
+            floatField("Labels", "fLabelXOffset", &VRUISettings::labelXOffset, -kOffset, kOffset, Inv::Labels),
+            floatField("Labels", "fLabelYOffset", &VRUISettings::labelYOffset, -kOffset, kOffset, Inv::Labels),
+            floatField("Labels", "fLabelZOffset", &VRUISettings::labelZOffset, -kOffset, kOffset, Inv::Labels,
+                "Vertical elevation above the button"),
+            floatField("Labels", "fLabelSpacing", &VRUISettings::labelSpacing, -kUnbounded, kUnbounded, Inv::Labels,
+                "Distance between characters in a string"),
+            floatField("Labels", "fLabelRotX", &VRUISettings::labelRotX, -kAngle, kAngle, Inv::Labels),
+            floatField("Labels", "fLabelRotY", &VRUISettings::labelRotY, -kAngle, kAngle, Inv::Labels),
+            floatField("Labels", "fLabelRotZ", &VRUISettings::labelRotZ, -kAngle, kAngle, Inv::Labels),
+
+            // Debug
+            boolField("Debug", "bDebugMode", &VRUISettings::debugMode, Inv::PerFrame,
+                "Enable debug visuals (AABB boxes, etc)"),
+
+            // Slots (sSlot<N>, sSlot<N>Image, ... written slot by slot)
+            slotField("", &SlotConfig::action, Inv::Slots, "Actions for Page"),
+            slotField("Image", &SlotConfig::texture, Inv::Meshes),
+            slotField("Nif", &SlotConfig::nif, Inv::Meshes),
+            slotField("Label", &SlotConfig::label, Inv::Slots),
+            slotField("Sublabel", &SlotConfig::sublabel, Inv::Slots),
+        };
+        // clang-format on
+    }
+
+    std::span<const SettingField> settingsSchema()
+    {
+        return kFields;
+    }
+
+    const SettingField* findSettingField(std::string_view key)
+    {
+        for (const auto& field : kFields) {
+            if (key == field.key) return &field;
+        }
+        return nullptr;
+    }
+
+    const VRUISettings& defaultSettings()
+    {
+        static const VRUISettings defaults{};
+        return defaults;
+    }
+
+    SettingsInvalidation diffSettings(const VRUISettings& before, const VRUISettings& after)
+    {
+        SettingsInvalidation changed = SettingsInvalidation::None;
+        for (const auto& field : kFields) {
+            if (!field.equal(before, after)) {
+                changed |= field.invalidates;
+            }
+        }
+        return changed;
+    }
+
+    bool SettingField::clamp(VRUISettings& settings) const
+    {
+        if (!hasRange()) return false;
+
+        if (type == Type::Float) {
+            float& value = settings.*floatMember;
+            float clamped = std::clamp(value, minValue, maxValue);
+            if (clamped == value) return false;
+            value = clamped;
+            return true;
+        }
+        if (type == Type::Int) {
+            int& value = settings.*intMember;
+            int clamped = std::clamp(value, static_cast<int>(minValue), static_cast<int>(maxValue));
+            if (clamped == value) return false;
+            value = clamped;
+            return true;
+        }
+        return false;
+    }
+    bool SettingField::equal(const VRUISettings& a, const VRUISettings& b) const
+    {
+        switch (type) {
+        case Type::Bool:
+            return a.*boolMember == b.*boolMember;
+        case Type::Int:
+            return a.*intMember == b.*intMember;
+        case Type::Float:
+            return a.*floatMember == b.*floatMember;
+        case Type::String:
+            return a.*stringMember == b.*stringMember;
+        case Type::SlotStrings:
+            return a.slots.sameField(b.slots, slotMember);
+        }
+        return true;
+    }
+}
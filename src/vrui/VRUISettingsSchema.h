@@ -0,0 +1,94 @@
+#pragma once
+
+#include "VRUISettings.h"
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace vrui
+{
+    /// Work that has to happen when a setting changes (see VRMenuManager::applySettingsChanges).
+    /// Cheapest first: PerFrame settings are read where they are used and need nothing.
+    enum class SettingsInvalidation : uint16_t
+    {
+        None = 0,
+        PerFrame = 1 << 0,       // Activation, touch, raycast, haptics, background placement, debug
+        Transform = 1 << 1,      // Panel offset, rotation and scale
+        MeshTransform = 1 << 2,  // Button mesh rotation and scale
+        Labels = 1 << 3,         // Label style: re-lay the label text
+        Slots = 1 << 4,          // Slot labels and actions
+        Layout = 1 << 5,         // Spacing, grid order, menu hand: relayout and reattach
+        Meshes = 1 << 6,         // Mesh and texture paths, UV flips: reload the affected meshes
+        Assets = 1 << 7,         // Loader and model cache budgets
+        Logging = 1 << 8
+    };
+
+    constexpr SettingsInvalidation operator|(SettingsInvalidation a, SettingsInvalidation b)
+    {
+        return static_cast<SettingsInvalidation>(static_cast<uint16_t>(a) | static_cast<uint16_t>(b));
+    }
+
+    constexpr SettingsInvalidation& operator|=(SettingsInvalidation& a, SettingsInvalidation b)
+    {
+        return a = a | b;
+    }
+
+    constexpr bool any(SettingsInvalidation flags, SettingsInvalidation mask)
+    {
+        return (static_cast<uint16_t>(flags) & static_cast<uint16_t>(mask)) != 0;
+    }
+
+    /// One INI key of VRUISettings. The table of these (settingsSchema()) is the only place
+    /// keys are listed: load, save, validation and the MCM rows all iterate it.
+    /// Defaults are the VRUISettings member initializers (see defaultSettings()).
+    struct SettingField
+    {
+        enum class Type : uint8_t
+        {
+            Bool,
+            Int,
+            Float,
+            String,
+            SlotStrings  // A SlotConfig member of VRUISettings::slots, keys "sSlot<N><key>"
+        };
+
+        const char* section = nullptr;
+        const char* key = nullptr;  // Full key, or the suffix after "sSlot<N>" for SlotStrings
+        Type type = Type::Bool;
+
+        bool VRUISettings::*boolMember = nullptr;
+        int VRUISettings::*intMember = nullptr;
+        float VRUISettings::*floatMember = nullptr;
+        std::string VRUISettings::*stringMember = nullptr;
+        std::string SlotConfig::*slotMember = nullptr;
+
+        float minValue = 0.0f;  // Range for Int/Float (min > max = unbounded)
+        float maxValue = -1.0f;
+        float step = 0.0f;      // MCM +/- step
+
+        const char* comment = nullptr;  // INI comment (SlotStrings: written once per page)
+        const char* label = nullptr;    // MCM row label (nullptr = not in the MCM)
+        SettingsInvalidation invalidates = SettingsInvalidation::None;
+
+        constexpr bool hasRange() const { return minValue <= maxValue; }
+        constexpr bool inMcm() const { return label != nullptr; }
+
+        /// Clamp `settings`' value into range. Returns true if it had to be changed.
+        bool clamp(VRUISettings& settings) const;
+
+        /// True if `a` and `b` hold the same value for this field (every slot for SlotStrings)
+        bool equal(const VRUISettings& a, const VRUISettings& b) const;
+    };
+
+    /// Every field, in INI order
+    std::span<const SettingField> settingsSchema();
+
+    /// Field with INI key `key` (exact match; SlotStrings are found by suffix), or nullptr
+    const SettingField* findSettingField(std::string_view key);
+
+    /// A default-constructed VRUISettings (the defaults of every field)
+    const VRUISettings& defaultSettings();
+
+    /// Union of the invalidation flags of every field that differs between two snapshots
+    SettingsInvalidation diffSettings(const VRUISettings& before, const VRUISettings& after);
+}
@@ -0,0 +1,44 @@
+#include "VRUISettingsStore.h"
+#include "VRUIWidget.h"
+
+namespace vrui
+{
+    VRUISettingsStore& VRUISettingsStore::get()
+    {
+        static VRUISettingsStore instance;
+        return instance;
+    }
+
+    SettingsTransforms SettingsTransforms::from(const VRUISettings& settings)
+    {
+        SettingsTransforms result;
+        result.menuRotation.SetEulerAnglesXYZ(
+            settings.menuRotX * kDegToRad, settings.menuRotY * kDegToRad, settings.menuRotZ * kDegToRad);
+        result.backgroundRotation.SetEulerAnglesXYZ(
+            settings.backgroundRotX * kDegToRad, settings.backgroundRotY * kDegToRad, settings.backgroundRotZ * kDegToRad);
+        result.buttonMeshRotation.SetEulerAnglesXYZ(
+            settings.buttonMeshRotX * kDegToRad, settings.buttonMeshRotY * kDegToRad, settings.buttonMeshRotZ * kDegToRad);
+        result.labelRotation.SetEulerAnglesXYZ(
+            settings.labelRotX * kDegToRad, settings.labelRotY * kDegToRad, settings.labelRotZ * kDegToRad);
+        return result;
+    }
+
+    const SettingsTransforms& VRUISettingsStore::transforms()
+    {
+        // Widgets built during initialization run before the first publish()
+        if (!_frame) _transforms = SettingsTransforms::from(VRUISettings::get());
+        return _transforms;
+    }
+
+    uint64_t VRUISettingsStore::publish()
+    {
+        if (!_changed.exchange(false, std::memory_order_acq_rel)) return _version;
+
+        // Copied once per change; readers never see a half-applied edit
+        _frame = std::make_shared<const VRUISettings>(VRUISettings::get());
+        _transforms = SettingsTransforms::from(*_frame);
+        _version++;
+        logger::debug("ImmersiveUI: Published settings version {}", _version);
+        return _version;
+    }
+}
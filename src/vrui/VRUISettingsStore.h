@@ -0,0 +1,59 @@
+#pragma once
+
+#include "VRUISettings.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace vrui
+{
+    /// Transforms derived from one settings version (rotations in degrees -> matrices)
+    struct SettingsTransforms
+    {
+        RE::NiMatrix3 menuRotation;
+        RE::NiMatrix3 backgroundRotation;
+        RE::NiMatrix3 buttonMeshRotation;   // Button, slider and icon meshes
+        RE::NiMatrix3 labelRotation;
+
+        static SettingsTransforms from(const VRUISettings& settings);
+    };
+
+    /// Immutable, versioned copies of VRUISettings for the per-frame code.
+    ///
+    /// VRUISettings::get() stays the one mutable instance: the MCM, the INI reload and
+    /// initialization write to it and call markChanged(). At the start of every frame
+    /// publish() copies it into a new const snapshot if it changed, so input, hit tests,
+    /// layout and panel transforms all read one consistent set of values for the whole
+    /// frame even if a setting is edited halfway through it. Code that derives data from
+    /// settings keeps the version it was built from and recomputes only when version()
+    /// moves on (container layout, button and slider mesh transforms).
+    class VRUISettingsStore
+    {
+    public:
+        static VRUISettingsStore& get();
+
+        /// The live settings were modified (picked up by the next publish())
+        void markChanged() { _changed.store(true, std::memory_order_release); }
+
+        /// Frame start, main thread: snapshot the live settings if they changed. Returns the version.
+        uint64_t publish();
+
+        /// This frame's settings (the live ones before the first publish()). Main thread;
+        /// the reference stays valid until the next publish().
+        const VRUISettings& frame() const { return _frame ? *_frame : VRUISettings::get(); }
+
+        /// Matrices derived from frame(), rebuilt by publish() rather than per widget
+        const SettingsTransforms& transforms();
+
+        /// Bumped by every publish() that produced a new snapshot (0 = none yet)
+        uint64_t version() const { return _version; }
+
+    private:
+        VRUISettingsStore() = default;
+
+        std::shared_ptr<const VRUISettings> _frame;
+        SettingsTransforms _transforms;
+        uint64_t _version = 0;
+        std::atomic<bool> _changed{ true };
+    };
+}
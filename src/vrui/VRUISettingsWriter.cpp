@@ -0,0 +1,162 @@
+#include "VRUISettingsWriter.h"
+#include "VRUIConfigWatcher.h"
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace vrui
+{
+    VRUISettingsWriter& VRUISettingsWriter::get()
+    {
+        static VRUISettingsWriter instance;
+        return instance;
+    }
+
+    void VRUISettingsWriter::save(const VRUISettings& settings, const std::string& iniPath, DoneCallback onDone,
+        const VRUISettings* overlayBase)
+    {
+        auto snapshot = std::make_unique<VRUISettings>(settings);
+        auto base = overlayBase ? std::make_unique<VRUISettings>(*overlayBase) : nullptr;
+
+        std::lock_guard lock(_mutex);
+        auto it = std::find_if(_pending.begin(), _pending.end(),
+            [&iniPath](const std::unique_ptr<Request>& pending) { return pending->path == iniPath; });
+        Request* request = nullptr;
+        if (it != _pending.end()) {
+            // Not picked up yet: the newer snapshot replaces it, callers are told once it is written
+            request = it->get();
+            request->coalesced++;
+        } else {
+            // Another file keeps its own request, so its snapshot and callbacks are not lost
+            request = _pending.emplace_back(std::make_unique<Request>()).get();
+            request->path = iniPath;
+        }
+        request->settings = std::move(snapshot);
+        request->overlayBase = std::move(base);
+        if (onDone) {
+            request->callbacks.push_back(std::move(onDone));
+        }
+
+        if (!_workerRunning) {
+            _workerRunning = true;
+            // Exits once nothing is pending, like the asset loader worker
+            std::thread(&VRUISettingsWriter::workerMain, this).detach();
+        }
+    }
+
+    bool VRUISettingsWriter::isBusy() const
+    {
+        std::lock_guard lock(_mutex);
+        return !_pending.empty() || _writing;
+    }
+
+    void VRUISettingsWriter::workerMain()
+    {
+        for (;;) {
+            std::unique_ptr<Request> request;
+            {
+                std::lock_guard lock(_mutex);
+                if (_pending.empty()) {
+                    _workerRunning = false;
+                    return;
+                }
+                request = std::move(_pending.front());
+                _pending.pop_front();
+                _writing = true;
+            }
+
+            Result result;
+            result.path = request->path;
+            result.coalesced = request->coalesced;
+            const auto& settings = *request->settings;
+            auto text = request->overlayBase ? settings.serializeOverlay(*request->overlayBase) : settings.serialize();
+            result.error = writeFileAtomic(request->path, text);
+            result.ok = result.error.empty();
+
+            std::lock_guard lock(_mutex);
+            _writing = false;
+            _completed.push_back(Completed{ std::move(result), std::move(request->callbacks) });
+        }
+    }
+
+    void VRUISettingsWriter::pump()
+    {
+        std::vector<Completed> completed;
+        {
+            std::lock_guard lock(_mutex);
+            if (_completed.empty()) return;
+            completed.swap(_completed);
+        }
+
+        for (auto& entry : completed) {
+            const auto& result = entry.result;
+            if (result.ok) {
+                logger::info("ImmersiveUI: Settings saved to '{}' ({} earlier saves coalesced)", result.path, result.coalesced);
+            } else {
+                logger::error("ImmersiveUI: Failed to save settings to '{}': {}", result.path, result.error);
+            }
+            for (auto& callback : entry.callbacks) {
+                callback(result);
+            }
+        }
+    }
+
+    std::string VRUISettingsWriter::writeFileAtomic(const std::string& path, const std::string& text)
+    {
+        std::filesystem::path target(path);
+        std::string temp = path + ".tmp";
+        std::error_code ec;
+
+        if (target.has_parent_path()) {
+            std::filesystem::create_directories(target.parent_path(), ec);
+            if (ec) return "cannot create directory: " + ec.message();
+        }
+
+        // The temporary file is flushed to disk before the rename, so after a crash or
+        // power loss the INI is the old or the new version, never a truncated one
+#ifdef _WIN32
+        HANDLE file = CreateFileA(temp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return "cannot open '" + temp + "'";
+
+        DWORD written = 0;
+        bool ok = WriteFile(file, text.data(), static_cast<DWORD>(text.size()), &written, nullptr) &&
+                  written == text.size() && FlushFileBuffers(file);
+        CloseHandle(file);
+        if (!ok) {
+            DeleteFileA(temp.c_str());
+            return "write to '" + temp + "' failed";
+        }
+
+        // Replaces the old file in one step: readers see either the old or the new contents
+        if (!MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+            DeleteFileA(temp.c_str());
+            return "cannot replace '" + path + "' (error " + std::to_string(GetLastError()) + ")";
+        }
+#else
+        int fd = ::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return "cannot open '" + temp + "'";
+
+        bool ok = ::write(fd, text.data(), text.size()) == static_cast<ssize_t>(text.size()) && ::fsync(fd) == 0;
+        ::close(fd);
+        if (!ok) {
+            ::unlink(temp.c_str());
+            return "write to '" + temp + "' failed";
+        }
+
+        if (::rename(temp.c_str(), path.c_str()) != 0) {
+            ::unlink(temp.c_str());
+            return "cannot replace '" + path + "'";
+        }
+#endif
+        // The INI watcher must not reload what the plugin itself just saved
+        VRUIConfigWatcher::get().noteOwnWrite(path);
+        return {};
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "VRUISettings.h"
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vrui
+{
+    /// Saves VRUISettings off the game thread.
+    ///
+    /// save() copies the settings and returns; a worker serializes the copy, writes it
+    /// to "<path>.tmp", flushes that to disk and renames it over the INI, so the file is
+    /// always either the old or the new version, even after a crash. Each path has at
+    /// most one waiting request: saves to a path that is already waiting are coalesced
+    /// into the newest snapshot, saves to other paths queue behind it in order.
+    /// Completion callbacks run on the main thread from pump().
+    class VRUISettingsWriter
+    {
+    public:
+        struct Result
+        {
+            bool ok = false;
+            std::string path;
+            std::string error;
+            uint32_t coalesced = 0;  // Older saves this write replaced
+        };
+
+        /// Main thread only
+        using DoneCallback = std::function<void(const Result&)>;
+
+        static VRUISettingsWriter& get();
+
+        /// Queue `settings` to be written to `iniPath`. `onDone` runs from pump() once the
+        /// snapshot (or a newer one that replaced it) is on disk or failed to write.
+        /// With `overlayBase`, only the keys that differ from it are written (a profile file).
+        void save(const VRUISettings& settings, const std::string& iniPath, DoneCallback onDone = {},
+            const VRUISettings* overlayBase = nullptr);
+
+        /// Main thread: deliver completion callbacks
+        void pump();
+
+        /// True while a save is waiting or being written
+        bool isBusy() const;
+
+        /// Write `text` to `path` via a temporary file that is flushed to disk, then renamed
+        /// over `path` (creates the directory).
+        /// Returns an empty string on success, otherwise the error.
+        static std::string writeFileAtomic(const std::string& path, const std::string& text);
+
+    private:
+        VRUISettingsWriter() = default;
+
+        struct Request
+        {
+            std::unique_ptr<VRUISettings> settings;
+            std::unique_ptr<VRUISettings> overlayBase;  // Write only what differs from it
+            std::string path;
+            std::vector<DoneCallback> callbacks;
+            uint32_t coalesced = 0;
+        };
+
+        struct Completed
+        {
+            Result result;
+            std::vector<DoneCallback> callbacks;
+        };
+
+        void workerMain();
+
+        mutable std::mutex _mutex;
+        std::deque<std::unique_ptr<Request>> _pending;  // One per path, in the order first requested
+        std::vector<Completed> _completed;
+        bool _workerRunning = false;
+        bool _writing = false;
+    };
+}
@@ -1,5 +1,5 @@
 #include "VRUISlider.h"
-#include "VRUISettings.h"
+#include "VRUISettingsStore.h"
 #include "VRMenuManager.h"
 #include <cmath>
 
@@ -16,26 +16,42 @@ namespace vrui
 
     void VRUISlider::initializeVisuals()
     {
-        auto& settings = VRUISettings::get();
-        float radX = settings.buttonMeshRotX * (kDegToRad);
-        float radY = settings.buttonMeshRotY * (kDegToRad);
-        float radZ = settings.buttonMeshRotZ * (kDegToRad);
+        auto& store = VRUISettingsStore::get();
+        const auto& settings = store.frame();
+        const auto& meshRotation = store.transforms().buttonMeshRotation;
 
         // 1. Create Background Track (Segmented Bar)
-        _backgroundTrack = RE::NiPointer<RE::NiNode>(RE::NiNode::Create());
-        _backgroundTrack->name = _name + "_track";
-        
         int segments = 40;
         float segmentStep = _width / (float)segments;
+        auto trackRect = MeshRect::centered(_width, _height * 0.3f);
+
+        _trackMesh = VRUIProceduralMesh::create(_name + "_track");
+        if (_trackMesh) {
+            // One generated mesh for the whole track, plus the value fill just in front of it
+            MeshData track;
+            appendSegmentedBar(track, trackRect, segments, 0.1f, { 0.15f, 0.15f, 0.15f, 0.9f });
+            _trackMesh->setMesh(track);
+            _backgroundTrack = RE::NiPointer<RE::NiNode>(_trackMesh->getNode());
+
+            _fillMesh = VRUIProceduralMesh::create(_name + "_fill");
+            if (_fillMesh) {
+                _backgroundTrack->AttachChild(_fillMesh->getNode());
+            }
+        } else {
+            _backgroundTrack = RE::NiPointer<RE::NiNode>(RE::NiNode::Create());
+            _backgroundTrack->name = _name + "_track";
+        }
 
-        for (int i = 0; i < segments; ++i) {
+        _segments.clear();
+        for (int i = 0; !_trackMesh && i < segments; ++i) {
             auto segment = createQuadNode(_name + "_seg_" + std::to_string(i), segmentStep * 1.1f, _height * 0.3f, { 0.15f, 0.15f, 0.15f, 0.9f });
             if (segment) {
                 float x = -_width * 0.5f + (i * segmentStep) + (segmentStep * 0.5f);
                 segment->local.translate.x = x;
-                segment->local.rotate.SetEulerAnglesXYZ(radX, radY, radZ);
+                segment->local.rotate = meshRotation;
                 segment->local.scale = settings.buttonMeshScale; // Match general mesh scale
                 _backgroundTrack->AttachChild(segment.get());
+                _segments.push_back(std::move(segment));
             }
         }
 
@@ -48,19 +64,54 @@ namespace vrui
         if (!_handle) {
             _handle = loadModelFromNif("immersiveUI\\slot01.nif");
         }
+        _handleBaseScale = settings.buttonMeshScale;
+        _generatedHandle = false;
         if (!_handle) {
              _handle = createQuadNode(_name + "_handle", _height * 1.5f, _height * 1.5f, { 1.0f, 1.0f, 1.0f, 1.0f });
+             // A generated quad is already sized and oriented in widget space
+             _generatedHandle = VRUIProceduralMesh::isPoolAvailable();
+             if (_generatedHandle) _handleBaseScale = 1.0f;
         }
         
         if (_node && _handle) {
-            _handle->local.rotate.SetEulerAnglesXYZ(radX, radY, radZ);
-            _handle->local.scale = settings.buttonMeshScale * 1.2f; // Slightly larger handle
+            if (!_generatedHandle) {
+                _handle->local.rotate = meshRotation;
+            }
+            _handle->local.scale = _handleBaseScale * 1.2f; // Slightly larger handle
             _node->AttachChild(_handle.get());
         }
+        _meshTransformVersion = store.version();
 
         updateHandlePosition();
     }
 
+    void VRUISlider::applyMeshTransform()
+    {
+        auto& store = VRUISettingsStore::get();
+        uint64_t version = store.version();
+        if (version != 0 && version == _meshTransformVersion) return;
+        _meshTransformVersion = version;
+
+        const auto& meshRotation = store.transforms().buttonMeshRotation;
+        float meshScale = store.frame().buttonMeshScale;
+
+        for (auto& segment : _segments) {
+            segment->local.rotate = meshRotation;
+            segment->local.scale = meshScale;
+        }
+
+        if (_handle && !_generatedHandle) {
+            _handle->local.rotate = meshRotation;
+            _handleBaseScale = meshScale;
+            _handle->local.scale = (_isHovered || _isDragging) ? _handleBaseScale * 1.2f : _handleBaseScale;
+        }
+
+        if (_node) {
+            RE::NiUpdateData updateData;
+            _node->Update(updateData);
+        }
+    }
+
     void VRUISlider::setValue(float value, bool triggerCallback)
     {
         float clamped = std::clamp(value, _minValue, _maxValue);
@@ -76,14 +127,14 @@ namespace vrui
     void VRUISlider::onRayEnter()
     {
         _isHovered = true;
-        if (_handle) _handle->local.scale = VRUISettings::get().buttonMeshScale * 1.2f; // Visual feedback
+        if (_handle) _handle->local.scale = _handleBaseScale * 1.2f; // Visual feedback
     }
 
     void VRUISlider::onRayExit()
     {
         _isHovered = false;
         if (!_isDragging && _handle) {
-            _handle->local.scale = VRUISettings::get().buttonMeshScale;
+            _handle->local.scale = _handleBaseScale;
         }
     }
 
@@ -96,7 +147,7 @@ namespace vrui
     {
         _isDragging = false;
         if (!_isHovered && _handle) {
-            _handle->local.scale = VRUISettings::get().buttonMeshScale;
+            _handle->local.scale = _handleBaseScale;
         }
     }
 
@@ -113,12 +164,24 @@ namespace vrui
         }
     }
 
-    void VRUISlider::updateHandlePosition()
+    void VRUISlider::updateFill(float percent)
     {
-        if (!_handle) return;
+        if (!_fillMesh) return;
 
+        // Always one quad, so this only rewrites four vertex positions
+        _fillScratch.clear();
+        appendProgressFill(_fillScratch, MeshRect::centered(_width, _height * 0.3f), percent,
+            { 0.35f, 0.6f, 0.9f, 0.9f }, 0.05f);
+        _fillMesh->setMesh(_fillScratch);
+    }
+
+    void VRUISlider::updateHandlePosition()
+    {
         float range = _maxValue - _minValue;
         float percent = (range > 0.0001f) ? (_currentValue - _minValue) / range : 0.5f;
+        updateFill(percent);
+
+        if (!_handle) return;
         
         // Map 0-1 to local coordinate X from -width/2 to +width/2
         float localX = (percent - 0.5f) * _width;
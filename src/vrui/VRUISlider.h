@@ -1,7 +1,10 @@
 #pragma once
 
 #include "VRUIWidget.h"
+#include "VRUIProceduralMesh.h"
 #include <functional>
+#include <memory>
+#include <vector>
 
 namespace vrui
 {
@@ -30,8 +33,13 @@ namespace vrui
 
         void initializeVisuals() override;
 
+        /// Re-apply fButtonMeshRot/Scale to the fallback track segments and the NIF handle
+        /// (no-op if they already have this settings version's transform)
+        void applyMeshTransform();
+
     private:
         void updateHandlePosition();
+        void updateFill(float percent);
         float calculateValueFromRay(const RE::NiPoint3& worldOrigin, const RE::NiPoint3& worldDir);
 
         float _minValue;
@@ -42,6 +50,15 @@ namespace vrui
 
         RE::NiPointer<RE::NiNode> _backgroundTrack;
         RE::NiPointer<RE::NiNode> _handle;
+        float _handleBaseScale = 1.0f;  // buttonMeshScale for NIF handles, 1 for a generated quad
+        bool _generatedHandle = false;  // Handle is a generated quad (not rotated or scaled by settings)
+        uint64_t _meshTransformVersion = 0;  // Settings version the segments and handle were built with
+        std::vector<RE::NiPointer<RE::NiNode>> _segments;  // Fallback track (no quad pool)
+
+        // Generated track and value fill (null when the quad pool is not installed)
+        std::unique_ptr<VRUIProceduralMesh> _trackMesh;
+        std::unique_ptr<VRUIProceduralMesh> _fillMesh;
+        MeshData _fillScratch;
 
         ValueChangedCallback _onValueChanged;
     };
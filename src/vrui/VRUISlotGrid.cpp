@@ -0,0 +1,85 @@
+#include "VRUISlotGrid.h"
+#include <algorithm>
+
+#ifdef max
+#undef max
+#endif
+#ifdef min
+#undef min
+#endif
+
+namespace vrui
+{
+    VRUISlotGrid::VRUISlotGrid(const std::string& name, int slotsPerPage, float spacing)
+        : VRUIContainer(name, ContainerLayout::Grid, spacing)
+        , _slotsPerPage(std::max(1, slotsPerPage))
+    {
+        // Pagination is done here by swapping children, not by the Grid layout
+        _pageSize = 0;
+        _pages.resize(1);
+    }
+
+    void VRUISlotGrid::setPageCount(int count)
+    {
+        _pageCount = std::max(1, count);
+        _pages.resize(static_cast<std::size_t>(_pageCount));
+
+        if (_currentPage >= _pageCount || getChildren().empty()) {
+            showPage(std::min(_currentPage, _pageCount - 1));
+        }
+    }
+
+    void VRUISlotGrid::setPage(int page)
+    {
+        showPage(std::clamp(page, 0, _pageCount - 1));
+
+        // Trigger cascade entrance animation on the new page
+        int visibleIdx = 0;
+        for (auto& child : _children) {
+            if (child && child->isVisible()) {
+                child->startScaleAnimation(visibleIdx * 2);
+                visibleIdx++;
+            }
+        }
+    }
+
+    void VRUISlotGrid::releaseHiddenPages()
+    {
+        for (int page = 0; page < _pageCount; ++page) {
+            if (page != _currentPage) {
+                _pages[page].clear();
+            }
+        }
+    }
+
+    void VRUISlotGrid::rebuildCurrentPage()
+    {
+        _pages[_currentPage].clear();
+        showPage(_currentPage);
+    }
+
+    int VRUISlotGrid::getBuiltPageCount() const
+    {
+        return static_cast<int>(std::count_if(_pages.begin(), _pages.end(), [](const Page& page) { return !page.empty(); }));
+    }
+
+    void VRUISlotGrid::showPage(int page)
+    {
+        _currentPage = page;
+
+        auto& widgets = _pages[page];
+        if (widgets.empty() && _factory) {
+            widgets.reserve(static_cast<std::size_t>(_slotsPerPage));
+            int first = page * _slotsPerPage;
+            for (int slot = first; slot < first + _slotsPerPage; ++slot) {
+                if (auto widget = _factory(slot)) {
+                    widgets.push_back(std::move(widget));
+                }
+            }
+            logger::info("ImmersiveUI: SlotGrid '{}' built page {} ({} of {} pages built)",
+                _name, page + 1, getBuiltPageCount(), _pageCount);
+        }
+
+        setElements(widgets);
+    }
+}
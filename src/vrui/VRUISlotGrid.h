@@ -0,0 +1,58 @@
+#pragma once
+
+#include "VRUIContainer.h"
+
+#include <functional>
+
+namespace vrui
+{
+    /// Paged grid of menu slots that builds a page the first time it is shown.
+    ///
+    /// Only the current page's widgets are children (laid out by the Grid layout);
+    /// pages that were shown before keep their widgets detached so paging back is
+    /// free, and pages never visited are never built. Slot `pageIndex * slotsPerPage + i`
+    /// is created by the factory. Widget count grows with the pages actually
+    /// opened, not with the number of pages configured.
+    class VRUISlotGrid : public VRUIContainer
+    {
+    public:
+        using Factory = std::function<std::shared_ptr<VRUIWidget>(int slotIndex)>;
+
+        /// @param name          Container identifier
+        /// @param slotsPerPage  Cells per page (3 columns)
+        /// @param spacing       Space between cells (in game units)
+        VRUISlotGrid(const std::string& name, int slotsPerPage, float spacing = 0.3f);
+
+        void setFactory(Factory factory) { _factory = std::move(factory); }
+
+        /// Number of pages; built pages past the new count are dropped.
+        /// Dropping destroys widgets: clear any raw pointers to them (hover) first.
+        void setPageCount(int count);
+
+        // --- Paging ---
+        void setPage(int page) override;
+        int getTotalPages() const override { return _pageCount; }
+        int getPageSize() const override { return _slotsPerPage; }
+
+        /// Drop every built page except the current one (they are rebuilt when next shown).
+        /// Destroys widgets, like setPageCount.
+        void releaseHiddenPages();
+
+        /// Rebuild the current page from the factory now. Destroys widgets, like setPageCount.
+        void rebuildCurrentPage();
+
+        /// Pages whose widgets exist
+        int getBuiltPageCount() const;
+
+    private:
+        /// Build `page` if needed and make its widgets the children
+        void showPage(int page);
+
+        using Page = std::vector<std::shared_ptr<VRUIWidget>>;
+
+        int _slotsPerPage;
+        int _pageCount = 1;
+        Factory _factory;
+        std::vector<Page> _pages;  // Empty = not built
+    };
+}
@@ -0,0 +1,108 @@
+#include "VRUISlotTable.h"
+#include <algorithm>
+
+namespace vrui
+{
+    namespace
+    {
+        const SlotConfig kEmptySlot{};
+
+        auto findEntry(std::vector<VRUISlotTable::Entry>& slots, int index)
+        {
+            return std::lower_bound(slots.begin(), slots.end(), index,
+                [](const VRUISlotTable::Entry& entry, int i) { return entry.index < i; });
+        }
+    }
+
+    bool SlotConfig::isEmpty() const
+    {
+        return (action.empty() || action == "None") && texture.empty() && nif.empty() && label.empty() && sublabel.empty();
+    }
+
+    VRUISlotTable::VRUISlotTable(std::initializer_list<std::pair<int, SlotConfig>> slots)
+    {
+        for (const auto& [index, config] : slots) {
+            if (index < 0 || index >= kMaxSlots || config.isEmpty()) continue;
+            auto it = findEntry(_slots, index);
+            if (it != _slots.end() && it->index == index) {
+                it->config = config;
+            } else {
+                _slots.insert(it, Entry{ index, config });
+            }
+        }
+    }
+
+    VRUISlotTable VRUISlotTable::defaults()
+    {
+        auto action = [](const char* name) {
+            SlotConfig slot;
+            slot.action = name;
+            return slot;
+        };
+
+        return {
+            { 0, action("Save") }, { 1, action("Wait") }, { 2, action("TweenMenu") },
+            { 3, action("Inventory") }, { 4, action("Magic") }, { 5, action("Map") },
+            { 6, action("Journal") }, { 8, action("NextPage") },   // Page 1
+            { 17, action("NextPage") },                             // Page 2
+            { 26, action("NextPage") },                             // Page 3
+            { 35, action("NextPage") }                              // Page 4
+        };
+    }
+
+    const SlotConfig& VRUISlotTable::get(int index) const
+    {
+        auto it = std::lower_bound(_slots.begin(), _slots.end(), index,
+            [](const Entry& entry, int i) { return entry.index < i; });
+        return it != _slots.end() && it->index == index ? it->config : kEmptySlot;
+    }
+
+    void VRUISlotTable::set(int index, Member member, std::string_view value)
+    {
+        if (index < 0 || index >= kMaxSlots) return;
+
+        auto it = findEntry(_slots, index);
+        if (it == _slots.end() || it->index != index) {
+            if (kEmptySlot.*member == value) return;  // Nothing to store
+            it = _slots.insert(it, Entry{ index, SlotConfig{} });
+        }
+
+        (it->config.*member).assign(value);
+        if (it->config.isEmpty()) {
+            _slots.erase(it);
+        }
+    }
+
+    void VRUISlotTable::put(int index, SlotConfig config)
+    {
+        if (index < 0 || index >= kMaxSlots) return;
+
+        auto it = _slots.empty() || _slots.back().index < index ? _slots.end() : findEntry(_slots, index);
+        bool exists = it != _slots.end() && it->index == index;
+        if (config.isEmpty()) {
+            if (exists) _slots.erase(it);
+        } else if (exists) {
+            it->config = std::move(config);
+        } else {
+            _slots.insert(it, Entry{ index, std::move(config) });
+        }
+    }
+
+    int VRUISlotTable::pageCount() const
+    {
+        if (_slots.empty()) return 1;
+        return _slots.back().index / kSlotsPerPage + 1;
+    }
+
+    bool VRUISlotTable::sameField(const VRUISlotTable& other, Member member) const
+    {
+        // A slot stored in only one table still compares against the other's empty slot
+        for (const auto& entry : _slots) {
+            if (entry.config.*member != other.get(entry.index).*member) return false;
+        }
+        for (const auto& entry : other._slots) {
+            if (entry.config.*member != get(entry.index).*member) return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vrui
+{
+    /// One menu slot as configured in [Slots] (sSlot<N>, sSlot<N>Image, ...).
+    /// A default-constructed slot is empty: action "None", default mesh and icon, no labels.
+    struct SlotConfig
+    {
+        std::string action = "None";  // sSlot<N>
+        std::string texture;          // sSlot<N>Image
+        std::string nif;              // sSlot<N>Nif
+        std::string label;            // sSlot<N>Label
+        std::string sublabel;         // sSlot<N>Sublabel
+
+        bool isEmpty() const;
+        bool operator==(const SlotConfig&) const = default;
+    };
+
+    /// Sparse, paged slot storage.
+    ///
+    /// Only slots with something configured are stored (sorted by index), so empty slots
+    /// cost nothing and the number of pages is whatever the last configured slot needs.
+    /// Indices are 0-based; the INI keys are 1-based (slot 0 = sSlot1).
+    class VRUISlotTable
+    {
+    public:
+        static constexpr int kSlotsPerPage = 9;  // The 3x3 grid
+        static constexpr int kMaxPages = 100;
+        static constexpr int kMaxSlots = kSlotsPerPage * kMaxPages;
+
+        using Member = std::string SlotConfig::*;
+
+        VRUISlotTable() = default;
+        VRUISlotTable(std::initializer_list<std::pair<int, SlotConfig>> slots);
+
+        /// The shipped layout: page 1 with the game menus, four pages ending in NextPage
+        static VRUISlotTable defaults();
+
+        /// Slot `index` (an empty slot if nothing is configured there)
+        const SlotConfig& get(int index) const;
+
+        /// Set one field of slot `index`; slots that end up empty are dropped
+        void set(int index, Member member, std::string_view value);
+
+        /// Replace the whole slot `index` (appending in index order is O(1))
+        void put(int index, SlotConfig config);
+
+        /// Pages up to the last configured slot (at least 1)
+        int pageCount() const;
+        int slotCount() const { return pageCount() * kSlotsPerPage; }
+
+        /// Slots actually stored
+        std::size_t configuredCount() const { return _slots.size(); }
+
+        /// True if `member` is the same for every slot of both tables
+        bool sameField(const VRUISlotTable& other, Member member) const;
+
+        bool operator==(const VRUISlotTable&) const = default;
+
+        struct Entry
+        {
+            int index = 0;
+            SlotConfig config;
+
+            bool operator==(const Entry&) const = default;
+        };
+
+        /// Configured slots, by index
+        const std::vector<Entry>& entries() const { return _slots; }
+
+    private:
+        std::vector<Entry> _slots;  // Sorted by index; never holds an empty slot
+    };
+}
@@ -0,0 +1,218 @@
+#include "VRUITextLayout.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace vrui
+{
+    int GlyphPoolLayout::glyphIndex(char c) const
+    {
+        char upper = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        auto pos = glyphs.find(upper);
+        return pos == std::string_view::npos ? -1 : static_cast<int>(pos);
+    }
+
+    namespace
+    {
+        constexpr std::string_view kEllipsis = "...";
+
+        bool isSpace(char c) { return c == ' ' || c == '\t'; }
+
+        std::string_view trimRight(std::string_view s)
+        {
+            while (!s.empty() && isSpace(s.back())) s.remove_suffix(1);
+            return s;
+        }
+
+        /// Longest prefix of `line` that fits in maxWidth together with the ellipsis, plus the ellipsis
+        std::string ellipsize(std::string_view line, const FontMetrics& metrics, const TextStyle& style, float maxWidth)
+        {
+            std::size_t keep = line.size();
+            if (maxWidth > 0.0f) {
+                keep = 0;
+                TextPen pen(metrics, style);
+                float at = 0.0f;
+                for (std::size_t i = 0; i < line.size(); ++i) {
+                    pen.step(line[i], at);
+                    TextPen tail = pen;
+                    for (char c : kEllipsis) tail.step(c, at);
+                    if (tail.x > maxWidth) break;
+                    keep = i + 1;
+                }
+            }
+
+            std::string result(trimRight(line.substr(0, keep)));
+            result += kEllipsis;
+            return result;
+        }
+    }
+
+    TextPen::Step TextPen::step(char c, float& at)
+    {
+        if (isSpace(c)) {
+            x += style.spaceAdvance;
+            prev = 0;
+            return Step::Space;
+        }
+
+        if (!metrics.hasGlyph(c)) {
+            x += style.missingAdvance;
+            prev = 0;
+            return Step::Missing;
+        }
+
+        if (prev) {
+            x += style.advance * metrics.kerning(prev, c);
+        }
+        at = x;
+        x += style.advance * metrics.advance(c);
+        prev = c;
+        return Step::Glyph;
+    }
+
+    float measureText(std::string_view text, const FontMetrics& metrics, const TextStyle& style)
+    {
+        TextPen pen(metrics, style);
+        float at = 0.0f;
+        for (char c : text) {
+            pen.step(c, at);
+        }
+        return pen.x;
+    }
+
+    TextLayoutResult layoutText(std::string_view text, const FontMetrics& metrics, const TextStyle& style,
+                                const TextLayoutOptions& options)
+    {
+        TextLayoutResult result;
+        const bool bounded = options.maxWidth > 0.0f;
+
+        std::size_t pos = 0;
+        while (pos < text.size()) {
+            if (options.maxLines > 0 && result.lines.size() >= static_cast<std::size_t>(options.maxLines)) {
+                result.truncated = true;
+                break;
+            }
+
+            TextPen pen(metrics, style);
+            float at = 0.0f;
+            std::size_t end = pos;
+            std::size_t lastSpace = std::string_view::npos;
+            bool forcedBreak = false;
+
+            for (; end < text.size(); ++end) {
+                char c = text[end];
+                if (c == '\n') {
+                    forcedBreak = true;
+                    break;
+                }
+
+                pen.step(c, at);
+
+                // Overflow: break at the last space, or inside the word if there is none.
+                // A line always keeps at least one character so layout makes progress.
+                if (bounded && pen.x > options.maxWidth && end > pos) {
+                    if (!isSpace(c) && lastSpace != std::string_view::npos && lastSpace > pos) {
+                        end = lastSpace;
+                    }
+                    break;
+                }
+
+                if (isSpace(c)) lastSpace = end;
+            }
+
+            auto line = trimRight(text.substr(pos, end - pos));
+            result.lines.push_back(TextLine{ std::string(line), measureText(line, metrics, style) });
+
+            pos = end;
+            if (forcedBreak) {
+                pos++;
+            } else {
+                // Spaces at a soft break are swallowed
+                while (pos < text.size() && isSpace(text[pos])) pos++;
+            }
+        }
+
+        if (result.truncated && options.ellipsize && !result.lines.empty()) {
+            auto& last = result.lines.back();
+            last.text = ellipsize(last.text, metrics, style, options.maxWidth);
+            last.width = measureText(last.text, metrics, style);
+        }
+
+        for (const auto& line : result.lines) {
+            result.width = std::max(result.width, line.width);
+        }
+        result.height = static_cast<float>(result.lines.size()) * metrics.lineHeight() * style.advance;
+
+        return result;
+    }
+
+    std::string fitText(std::string_view text, const FontMetrics& metrics, const TextStyle& style, float maxWidth)
+    {
+        TextLayoutOptions options;
+        options.maxWidth = maxWidth;
+        options.maxLines = 1;
+        options.ellipsize = true;
+
+        auto layout = layoutText(text, metrics, style, options);
+        return layout.lines.empty() ? std::string() : std::move(layout.lines.front().text);
+    }
+
+    GlyphQuadResult layoutGlyphQuads(std::string_view text, const GlyphPoolLayout& pool,
+                                     const FontMetrics& metrics, const TextStyle& style,
+                                     const std::array<TextVertex, 4>& baseQuad, std::span<TextVertex> outVertices)
+    {
+        GlyphQuadResult result;
+
+        // Everything starts collapsed; only quads used by the label get real corners
+        std::fill(outVertices.begin(), outVertices.end(), TextVertex{});
+        if (outVertices.size() < pool.vertexCount() || pool.copiesPerGlyph <= 0) {
+            return result;
+        }
+
+        std::array<int, 256> usedCopies{};
+        std::array<std::size_t, 256> placedQuads{};  // Quad index per placed glyph (labels are short)
+        std::array<float, 256> placedX{};
+
+        TextPen pen(metrics, style);
+        float lastX = 0.0f;
+        for (char c : text) {
+            float at = 0.0f;
+            if (pen.step(c, at) != TextPen::Step::Glyph) {
+                continue;
+            }
+            lastX = at;
+
+            int glyph = pool.glyphIndex(c);
+            int* copy = glyph >= 0 ? &usedCopies[static_cast<std::size_t>(glyph) & 0xFF] : nullptr;
+            if (!copy || *copy >= pool.copiesPerGlyph || result.placed >= placedQuads.size()) {
+                // Not in the pool or out of copies: the pen already moved, so the rest of the label lines up
+                result.dropped++;
+                continue;
+            }
+
+            placedQuads[result.placed] = static_cast<std::size_t>(glyph) * pool.copiesPerGlyph + *copy;
+            placedX[result.placed] = at;
+            result.placed++;
+            (*copy)++;
+        }
+
+        if (result.placed == 0 && result.dropped == 0) {
+            return result;
+        }
+
+        result.width = lastX;
+        float centerOffset = -result.width * 0.5f;
+
+        for (std::size_t i = 0; i < result.placed; ++i) {
+            float originX = placedX[i] + centerOffset;
+            auto* quad = &outVertices[placedQuads[i] * 4];
+            for (std::size_t v = 0; v < 4; ++v) {
+                quad[v].x = originX + baseQuad[v].x * style.scale;
+                quad[v].y = baseQuad[v].y * style.scale;
+                quad[v].z = baseQuad[v].z * style.scale;
+            }
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+// Pure text layout helpers. No game (RE::) dependencies: this header and its .cpp
+// can be compiled and exercised outside the game.
+
+#include "VRUIFontMetrics.h"
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vrui
+{
+    /// Position of one glyph-quad corner in label space
+    struct TextVertex
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+    };
+
+    /// Spacing rules used to place glyphs (same semantics as the per-glyph NIF labels)
+    struct TextStyle
+    {
+        float scale = 1.0f;           // Glyph scale
+        float advance = 0.2f;         // Pen advance after a glyph (multiplied by the glyph's metric advance)
+        float spaceAdvance = 0.4f;    // Pen advance for ' ' and '\t'
+        float missingAdvance = 0.1f;  // Pen advance for characters the font does not have
+    };
+
+    /// Walks a string left to right, applying per-glyph advances and kerning.
+    /// Every layout function below (and the per-glyph NIF fallback) places glyphs with this.
+    struct TextPen
+    {
+        enum class Step : uint8_t
+        {
+            Space,
+            Glyph,
+            Missing
+        };
+
+        TextPen(const FontMetrics& metrics, const TextStyle& style) : metrics(metrics), style(style) {}
+
+        /// Advance past `c`. For glyphs, `at` receives the pen position the glyph is drawn at.
+        Step step(char c, float& at);
+
+        const FontMetrics& metrics;
+        const TextStyle& style;
+        float x = 0.0f;
+        char prev = 0;  // Previous glyph, for kerning (0 after whitespace or a missing glyph)
+    };
+
+    /// Constraints for layoutText
+    struct TextLayoutOptions
+    {
+        float maxWidth = 0.0f;  // Line width limit in label units (<= 0: unbounded)
+        int maxLines = 1;       // <= 0: unlimited
+        bool ellipsize = true;  // End the last line with "..." when text had to be cut
+    };
+
+    struct TextLine
+    {
+        std::string text;
+        float width = 0.0f;  // measureText(text)
+    };
+
+    struct TextLayoutResult
+    {
+        std::vector<TextLine> lines;
+        float width = 0.0f;      // Widest line
+        float height = 0.0f;     // lines x metrics.lineHeight() x style.advance
+        bool truncated = false;  // Some of the input did not fit
+    };
+
+    /// Extent of `text` in label units: the pen position after its last character
+    float measureText(std::string_view text, const FontMetrics& metrics, const TextStyle& style);
+
+    /// Break `text` into lines no wider than options.maxWidth: at spaces where possible,
+    /// inside a word when it is wider than a line on its own. '\n' forces a break.
+    /// Text beyond options.maxLines is dropped (and the last line ellipsized if requested).
+    TextLayoutResult layoutText(std::string_view text, const FontMetrics& metrics, const TextStyle& style,
+                                const TextLayoutOptions& options);
+
+    /// Single-line convenience: `text` unchanged if it fits in maxWidth, otherwise cut with "..."
+    std::string fitText(std::string_view text, const FontMetrics& metrics, const TextStyle& style, float maxWidth);
+
+    /// Layout of a glyph-pool mesh: one mesh holding `copiesPerGlyph` quads for every
+    /// character of `glyphs`, in order. Quad q draws glyph (q / copiesPerGlyph); its four
+    /// vertices are consecutive and its UVs are baked into the mesh.
+    struct GlyphPoolLayout
+    {
+        std::string_view glyphs;
+        int copiesPerGlyph = 1;
+
+        std::size_t quadCount() const { return glyphs.size() * static_cast<std::size_t>(copiesPerGlyph); }
+        std::size_t vertexCount() const { return quadCount() * 4; }
+
+        /// Index of `c` (case-insensitive) in `glyphs`, or -1
+        int glyphIndex(char c) const;
+    };
+
+    struct GlyphQuadResult
+    {
+        std::size_t placed = 0;   // Glyph quads moved into the label
+        std::size_t dropped = 0;  // Glyphs skipped because every copy was in use
+        float width = 0.0f;       // Distance between the first and last glyph (before centering)
+    };
+
+    /// Write the vertex positions of a whole label into `outVertices` (pool.vertexCount() entries).
+    /// Glyph quads used by the label are placed along +X with `metrics` advances and kerning,
+    /// centered on the origin, using `baseQuad` (the template quad's corners relative to its
+    /// center) scaled by style.scale. Every other quad collapses to the origin so it rasterizes nothing.
+    GlyphQuadResult layoutGlyphQuads(std::string_view text, const GlyphPoolLayout& pool,
+                                     const FontMetrics& metrics, const TextStyle& style,
+                                     const std::array<TextVertex, 4>& baseQuad, std::span<TextVertex> outVertices);
+}
@@ -0,0 +1,136 @@
+#include "VRUITextMesh.h"
+#include "VRUIWidget.h"
+#include <RE/B/BSDynamicTriShape.h>
+#include <RE/B/BSVisit.h>
+#include <algorithm>
+
+namespace vrui
+{
+    namespace
+    {
+        /// Layout of one entry in BSDynamicTriShape::dynamicData (position + bitangent X in w)
+        struct DynamicVertex
+        {
+            float x;
+            float y;
+            float z;
+            float w;
+        };
+        static_assert(sizeof(DynamicVertex) == 16);
+
+        enum class AtlasState : uint8_t
+        {
+            Unknown,
+            Available,
+            Missing
+        };
+
+        AtlasState s_atlasState = AtlasState::Unknown;
+    }
+
+    GlyphPoolLayout VRUITextMesh::poolLayout()
+    {
+        return GlyphPoolLayout{ kAtlasGlyphs, kAtlasCopiesPerGlyph };
+    }
+
+    bool VRUITextMesh::isAtlasAvailable()
+    {
+        return s_atlasState == AtlasState::Available;
+    }
+
+    std::unique_ptr<VRUITextMesh> VRUITextMesh::create(const std::string& name)
+    {
+        // Don't probe the model DB again for every label once the atlas is known to be missing
+        if (s_atlasState == AtlasState::Missing) return nullptr;
+
+        auto root = VRUIWidget::loadModelFromNif(kAtlasNifPath);
+        if (!root) {
+            logger::info("ImmersiveUI: Font atlas '{}' not installed, labels use per-glyph NIFs", kAtlasNifPath);
+            s_atlasState = AtlasState::Missing;
+            return nullptr;
+        }
+
+        RE::BSDynamicTriShape* shape = nullptr;
+        RE::BSVisit::TraverseScenegraphGeometries(root.get(), [&](RE::BSGeometry* geom) -> RE::BSVisit::BSVisitControl {
+            shape = netimmerse_cast<RE::BSDynamicTriShape*>(geom);
+            if (!shape) return RE::BSVisit::BSVisitControl::kContinue;
+            geom->SetAppCulled(false);
+            return RE::BSVisit::BSVisitControl::kStop;
+        });
+
+        auto pool = poolLayout();
+        if (!shape) {
+            logger::warn("ImmersiveUI: Font atlas '{}' has no BSDynamicTriShape, labels use per-glyph NIFs", kAtlasNifPath);
+            s_atlasState = AtlasState::Missing;
+            return nullptr;
+        }
+
+        auto& dyn = shape->GetDynamicTrishapeRuntimeData();
+        std::size_t vertexCount = dyn.dynamicData ? dyn.dataSize / sizeof(DynamicVertex) : 0;
+        if (vertexCount < pool.vertexCount()) {
+            logger::warn("ImmersiveUI: Font atlas '{}' has {} vertices, expected {} ({} glyphs x {} copies x 4)",
+                kAtlasNifPath, vertexCount, pool.vertexCount(), kAtlasGlyphs.size(), kAtlasCopiesPerGlyph);
+            s_atlasState = AtlasState::Missing;
+            return nullptr;
+        }
+
+        auto mesh = std::unique_ptr<VRUITextMesh>(new VRUITextMesh());
+        mesh->_node = root;
+        mesh->_node->name = name;
+        mesh->_shape = shape;
+        mesh->_scratch.resize(pool.vertexCount());
+
+        // Template quad 0 gives the glyph corners; recentre them on the origin
+        {
+            RE::BSSpinLockGuard guard(dyn.lock);
+            const auto* verts = static_cast<const DynamicVertex*>(dyn.dynamicData);
+            TextVertex center;
+            for (int v = 0; v < 4; ++v) {
+                center.x += verts[v].x * 0.25f;
+                center.y += verts[v].y * 0.25f;
+                center.z += verts[v].z * 0.25f;
+            }
+            for (int v = 0; v < 4; ++v) {
+                mesh->_baseQuad[v] = { verts[v].x - center.x, verts[v].y - center.y, verts[v].z - center.z };
+            }
+        }
+
+        s_atlasState = AtlasState::Available;
+        return mesh;
+    }
+
+    bool VRUITextMesh::setText(std::string_view text, const TextStyle& style)
+    {
+        if (!_shape) return false;
+
+        auto result = layoutGlyphQuads(text, poolLayout(), FontMetrics::active(), style, _baseQuad, _scratch);
+        if (result.dropped > 0) {
+            // The pool size is baked into the NIF; the caller draws this label with per-glyph NIFs instead
+            static bool warned = false;
+            if (!warned) {
+                warned = true;
+                logger::warn("ImmersiveUI: Label '{}' has {} glyph(s) the font atlas cannot draw (not in the atlas, or more "
+                             "than {} copies of a character); such labels use per-glyph NIFs",
+                    text, result.dropped, kAtlasCopiesPerGlyph);
+            } else {
+                logger::debug("ImmersiveUI: Label '{}' does not fit the font atlas, using per-glyph NIFs", text);
+            }
+            return false;
+        }
+
+        auto& dyn = _shape->GetDynamicTrishapeRuntimeData();
+        {
+            RE::BSSpinLockGuard guard(dyn.lock);
+            auto* verts = static_cast<DynamicVertex*>(dyn.dynamicData);
+            if (!verts) return false;
+
+            std::size_t count = std::min<std::size_t>(dyn.dataSize / sizeof(DynamicVertex), _scratch.size());
+            for (std::size_t i = 0; i < count; ++i) {
+                verts[i].x = _scratch[i].x;
+                verts[i].y = _scratch[i].y;
+                verts[i].z = _scratch[i].z;
+            }
+        }
+        return true;
+    }
+}
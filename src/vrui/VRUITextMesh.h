@@ -0,0 +1,52 @@
+#pragma once
+
+#include "VRUITextLayout.h"
+#include <RE/Skyrim.h>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace vrui
+{
+    /// A whole text label rendered by a single BSDynamicTriShape (one node, one draw call).
+    ///
+    /// The geometry comes from a glyph-pool template NIF (see kAtlasNifPath): one mesh whose
+    /// quads sample a font atlas texture, `kAtlasCopiesPerGlyph` quads per character of
+    /// `kAtlasGlyphs`, UVs baked in. Setting text only rewrites the dynamic vertex positions
+    /// in place: used quads are moved into the label, the rest collapse to zero area.
+    class VRUITextMesh
+    {
+    public:
+        static constexpr const char* kAtlasNifPath = "immersiveUI\\font\\atlas.nif";
+        static constexpr std::string_view kAtlasGlyphs = FontMetrics::kDefaultGlyphs;
+        static constexpr int kAtlasCopiesPerGlyph = 6;
+
+        /// Create a label mesh, or nullptr if the atlas template is not installed
+        /// (callers then fall back to per-glyph NIFs).
+        static std::unique_ptr<VRUITextMesh> create(const std::string& name);
+
+        /// True once the template has been found (false after a failed lookup)
+        static bool isAtlasAvailable();
+
+        RE::NiNode* getNode() const { return _node.get(); }
+
+        /// Lay out `text` with the active font metrics and rewrite the vertex positions in place.
+        /// Returns false, leaving the mesh unchanged, if the pool cannot draw every glyph (a
+        /// character missing from the atlas or used more than kAtlasCopiesPerGlyph times), or
+        /// if there is no dynamic geometry.
+        bool setText(std::string_view text, const TextStyle& style);
+
+    private:
+        VRUITextMesh() = default;
+
+        /// Layout of the template NIF's glyph pool
+        static GlyphPoolLayout poolLayout();
+
+        RE::NiPointer<RE::NiNode> _node;
+        RE::BSDynamicTriShape* _shape = nullptr;
+
+        /// Corners of the template quad relative to its center (read from quad 0)
+        std::array<TextVertex, 4> _baseQuad{};
+        std::vector<TextVertex> _scratch;
+    };
+}
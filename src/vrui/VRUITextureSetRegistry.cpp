@@ -0,0 +1,80 @@
+#include "VRUITextureSetRegistry.h"
+
+namespace vrui
+{
+    VRUITextureSetRegistry& VRUITextureSetRegistry::get()
+    {
+        static VRUITextureSetRegistry instance;
+        return instance;
+    }
+
+    RE::NiPointer<RE::BSTextureSet> VRUITextureSetRegistry::acquire(std::string_view diffusePath)
+    {
+        if (diffusePath.empty()) return nullptr;
+
+        ResourceKey key(diffusePath);
+        auto it = _sets.find(key);
+        if (it != _sets.end()) {
+            _stats.reused++;
+            return it->second;
+        }
+
+        auto* textureSet = RE::BSShaderTextureSet::Create();
+        if (!textureSet) {
+            logger::error("ImmersiveUI: Failed to create BSShaderTextureSet for '{}'", diffusePath);
+            return nullptr;
+        }
+        // The engine keeps the path as given; only the lookup key is normalized
+        textureSet->SetTexturePath(RE::BSTextureSet::Texture::kDiffuse, std::string(diffusePath).c_str());
+
+        RE::NiPointer<RE::BSTextureSet> shared(textureSet);
+        _sets.emplace(key, shared);
+        _stats.created++;
+        _stats.live = _sets.size();
+        return shared;
+    }
+
+    bool VRUITextureSetRegistry::bind(RE::BSLightingShaderMaterialBase* material, const RE::NiPointer<RE::BSTextureSet>& textureSet)
+    {
+        if (!material || !textureSet) return false;
+
+        if (material->textureSet.get() == textureSet.get()) {
+            _stats.bindsSkipped++;
+            return true;
+        }
+
+        material->SetTextureSet(textureSet);
+        _stats.binds++;
+        return true;
+    }
+
+    void VRUITextureSetRegistry::releaseUnused()
+    {
+        std::erase_if(_sets, [&](const auto& entry) {
+            bool unused = entry.second && entry.second->GetRefCount() <= 1;
+            if (unused) _stats.released++;
+            return unused;
+        });
+        _stats.live = _sets.size();
+    }
+
+    void VRUITextureSetRegistry::release(std::string_view diffusePath)
+    {
+        auto it = _sets.find(ResourceKey(diffusePath));
+        if (it == _sets.end() || (it->second && it->second->GetRefCount() > 1)) return;
+
+        _sets.erase(it);
+        _stats.released++;
+        _stats.live = _sets.size();
+    }
+
+    void VRUITextureSetRegistry::logStats()
+    {
+        uint64_t acquires = _stats.created + _stats.reused;
+        if (acquires == _lastReportedAcquires) return;
+        _lastReportedAcquires = acquires;
+
+        logger::info("ImmersiveUI: Texture sets: {} live, {} created / {} reused / {} released, {} binds ({} skipped as already bound)",
+            _stats.live, _stats.created, _stats.reused, _stats.released, _stats.binds, _stats.bindsSkipped);
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "VRUIResourceKey.h"
+#include <RE/Skyrim.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace vrui
+{
+    /// One shared BSShaderTextureSet per diffuse texture (keyed by ResourceKey).
+    ///
+    /// Buttons and the laser used to create a texture set per mesh even when every slot
+    /// shows the same icon. The registry hands out a single refcounted set per path; a set
+    /// is dropped once nothing but the registry references it. UV flips live in the
+    /// material, not the texture set, so they are not part of the key. Main thread only.
+    class VRUITextureSetRegistry
+    {
+    public:
+        struct Stats
+        {
+            uint64_t created = 0;
+            uint64_t reused = 0;
+            uint64_t released = 0;
+            uint64_t binds = 0;
+            uint64_t bindsSkipped = 0;  // Material already had the shared set
+            std::size_t live = 0;
+        };
+
+        static VRUITextureSetRegistry& get();
+
+        /// Shared texture set for `diffusePath` (created on first use)
+        RE::NiPointer<RE::BSTextureSet> acquire(std::string_view diffusePath);
+
+        /// Point `material` at `textureSet`, skipping the bind if it already is
+        bool bind(RE::BSLightingShaderMaterialBase* material, const RE::NiPointer<RE::BSTextureSet>& textureSet);
+
+        /// Drop sets that only the registry still references
+        void releaseUnused();
+
+        /// Drop the set for `diffusePath` if only the registry still references it
+        void release(std::string_view diffusePath);
+
+        const Stats& getStats() const { return _stats; }
+
+        /// Log counters (only if anything was acquired since the last report)
+        void logStats();
+
+    private:
+        VRUITextureSetRegistry() = default;
+
+        std::unordered_map<ResourceKey, RE::NiPointer<RE::BSTextureSet>, ResourceKey::Hasher> _sets;
+        Stats _stats;
+        uint64_t _lastReportedAcquires = 0;
+    };
+}
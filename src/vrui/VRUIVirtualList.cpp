@@ -0,0 +1,219 @@
+#include "VRUIVirtualList.h"
+#include "VRUISettingsStore.h"
+#include <algorithm>
+#include <cmath>
+
+#ifdef max
+#undef max
+#endif
+#ifdef min
+#undef min
+#endif
+
+namespace vrui
+{
+    VRUIVirtualList::VRUIVirtualList(const std::string& name, int columns, int visibleRows,
+                                     float spacing, int marginRows)
+        : VRUIContainer(name, ContainerLayout::Free, spacing)
+        , _columns(std::max(1, columns))
+        , _visibleRows(std::max(1, visibleRows))
+        , _marginRows(std::max(0, marginRows))
+    {
+        _gridColumns = _columns;
+        _pageSize = _columns * _visibleRows;
+    }
+
+    int VRUIVirtualList::getTotalRows() const
+    {
+        return static_cast<int>((_itemCount + _columns - 1) / _columns);
+    }
+
+    int VRUIVirtualList::getTotalPages() const
+    {
+        int rows = getTotalRows();
+        return std::max(1, (rows + _visibleRows - 1) / _visibleRows);
+    }
+
+    void VRUIVirtualList::setItemCount(std::size_t count)
+    {
+        _itemCount = count;
+
+        // Keep the scroll position, but never start past the last page
+        int maxRow = std::max(0, (getTotalPages() - 1) * _visibleRows);
+        _firstRow = std::clamp(_firstRow, 0, maxRow);
+        _currentPage = _firstRow / _visibleRows;
+
+        rebindWindow(false);
+        recalculateLayout();
+    }
+
+    void VRUIVirtualList::invalidateItems()
+    {
+        rebindWindow(true);
+        recalculateLayout();
+    }
+
+    void VRUIVirtualList::scrollToRow(int row)
+    {
+        // Scrolling keeps the viewport full
+        int maxRow = std::max(0, getTotalRows() - _visibleRows);
+        setFirstRow(std::clamp(row, 0, maxRow));
+    }
+
+    void VRUIVirtualList::setFirstRow(int row)
+    {
+        if (row == _firstRow) return;
+
+        _firstRow = row;
+        _currentPage = _firstRow / _visibleRows;
+        rebindWindow(false);
+        recalculateLayout();
+    }
+
+    void VRUIVirtualList::setPage(int page)
+    {
+        // Paging may leave the last page partially filled, like the Grid layout
+        page = std::clamp(page, 0, getTotalPages() - 1);
+        setFirstRow(page * _visibleRows);
+
+        // Trigger cascade entrance animation on the visible cells
+        int visibleIdx = 0;
+        for (auto& slot : _pool) {
+            if (slot.widget->isVisible()) {
+                slot.widget->startScaleAnimation(visibleIdx * 2);
+                visibleIdx++;
+            }
+        }
+    }
+
+    void VRUIVirtualList::nextPage()
+    {
+        int total = getTotalPages();
+        setPage(_currentPage + 1 < total ? _currentPage + 1 : 0);
+    }
+
+    void VRUIVirtualList::prevPage()
+    {
+        setPage(_currentPage > 0 ? _currentPage - 1 : getTotalPages() - 1);
+    }
+
+    std::size_t VRUIVirtualList::getItemIndex(const VRUIWidget* widget) const
+    {
+        for (const auto& slot : _pool) {
+            if (slot.widget.get() == widget) return slot.item;
+        }
+        return kUnbound;
+    }
+
+    void VRUIVirtualList::ensurePool()
+    {
+        if (!_factory) return;
+
+        // Never allocate more widgets than there are items to show
+        std::size_t windowSize = static_cast<std::size_t>((_visibleRows + 2 * _marginRows) * _columns);
+        std::size_t wanted = std::min(windowSize, _itemCount);
+
+        while (_pool.size() < wanted) {
+            auto widget = _factory();
+            if (!widget) {
+                logger::warn("ImmersiveUI: VirtualList '{}' factory returned no widget", _name);
+                return;
+            }
+            widget->setVisible(false);
+            addChild(widget);
+            _pool.push_back({ std::move(widget), kUnbound });
+        }
+
+        if (!_pool.empty()) {
+            logger::trace("ImmersiveUI: VirtualList '{}' pool size {} for {} items", _name, _pool.size(), _itemCount);
+        }
+    }
+
+    void VRUIVirtualList::rebindWindow(bool force)
+    {
+        ensurePool();
+        if (_pool.empty()) return;
+
+        int startRow = std::max(0, _firstRow - _marginRows);
+        int endRow = std::min(getTotalRows(), _firstRow + _visibleRows + _marginRows);
+        std::size_t startItem = static_cast<std::size_t>(startRow) * _columns;
+        std::size_t endItem = std::min(_itemCount, static_cast<std::size_t>(std::max(endRow, 0)) * _columns);
+        std::size_t windowCount = endItem > startItem ? endItem - startItem : 0;
+
+        // Keep widgets whose item is still inside the window; everything else is recyclable
+        std::vector<bool> covered(windowCount, false);
+        std::vector<PoolSlot*> freeSlots;
+        for (auto& slot : _pool) {
+            if (!force && slot.item != kUnbound && slot.item >= startItem && slot.item < endItem) {
+                covered[slot.item - startItem] = true;
+            } else {
+                slot.item = kUnbound;
+                freeSlots.push_back(&slot);
+            }
+        }
+
+        std::size_t nextFree = 0;
+        int rebound = 0;
+        for (std::size_t i = 0; i < windowCount && nextFree < freeSlots.size(); ++i) {
+            if (covered[i]) continue;
+
+            auto* slot = freeSlots[nextFree++];
+            slot->item = startItem + i;
+            if (_binder) {
+                _binder(*slot->widget, slot->item);
+            }
+            rebound++;
+        }
+
+        logger::trace("ImmersiveUI: VirtualList '{}' rows [{}, {}) rebound {} of {} widgets",
+            _name, startRow, endRow, rebound, _pool.size());
+    }
+
+    void VRUIVirtualList::recalculateLayout()
+    {
+        _layoutDirty = false;
+
+        std::size_t viewStart = static_cast<std::size_t>(_firstRow) * _columns;
+        std::size_t viewEnd = std::min(_itemCount, viewStart + static_cast<std::size_t>(_pageSize));
+
+        if (!_pool.empty()) {
+            const auto& settings = VRUISettingsStore::get().frame();
+            float visualScale = settings.buttonMeshScale;
+            bool invertX = settings.invertGridX;
+
+            // Grid metrics follow the Grid layout: cell size from the first widget, centered block
+            const auto& first = _pool.front().widget;
+            float cellW = first->getWidth() * visualScale;
+            float cellH = first->getHeight() * visualScale;
+
+            int shown = static_cast<int>(viewEnd > viewStart ? viewEnd - viewStart : 0);
+            int rows = std::max(1, (shown + _columns - 1) / _columns);
+            int cols = std::max(1, std::min(shown, _columns));
+
+            float totalWidth = (cols * cellW) + ((cols - 1) * _spacing);
+            float totalHeight = (rows * cellH) + ((rows - 1) * _spacing);
+            float startX = -totalWidth * 0.5f + (cellW * 0.5f);
+            float startZ = totalHeight * 0.5f - (cellH * 0.5f);
+
+            for (auto& slot : _pool) {
+                bool inView = slot.item != kUnbound && slot.item >= viewStart && slot.item < viewEnd;
+                slot.widget->setVisible(inView);
+                if (!inView) continue;
+
+                int local = static_cast<int>(slot.item - viewStart);
+                int r = local / _columns;
+                int c = local % _columns;
+                if (invertX) {
+                    c = (cols - 1) - c;
+                }
+
+                float cx = startX + c * (cellW + _spacing);
+                float cz = startZ - r * (cellH + _spacing);
+                slot.widget->setLocalPosition(RE::NiPoint3{ cx, 0.0f, cz });
+            }
+        }
+
+        // Free layout: recurse into children and refresh our logical bounds
+        VRUIContainer::recalculateLayout();
+    }
+}
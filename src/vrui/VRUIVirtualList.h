@@ -0,0 +1,87 @@
+#pragma once
+
+#include "VRUIContainer.h"
+
+#include <cstddef>
+#include <functional>
+
+namespace vrui
+{
+    /// Scrolling grid/list that only keeps enough widgets for its viewport.
+    ///
+    /// Items are addressed by index; the list asks a factory for at most
+    /// (visibleRows + 2 * marginRows) * columns widgets and rebinds them with the
+    /// binder as the user scrolls or pages. Widgets whose item stays inside the
+    /// window keep their binding, so scrolling by one row only binds one row.
+    /// Memory and update cost depend on the viewport size, not the item count.
+    class VRUIVirtualList : public VRUIContainer
+    {
+    public:
+        using Factory = std::function<std::shared_ptr<VRUIWidget>()>;
+        using Binder = std::function<void(VRUIWidget& widget, std::size_t itemIndex)>;
+
+        static constexpr std::size_t kUnbound = static_cast<std::size_t>(-1);
+
+        /// @param name         Container identifier
+        /// @param columns      Items per row (1 = plain vertical list)
+        /// @param visibleRows  Rows shown at once
+        /// @param spacing      Space between cells (in game units)
+        /// @param marginRows   Extra rows kept bound (hidden) above and below the viewport
+        VRUIVirtualList(const std::string& name, int columns, int visibleRows,
+                        float spacing = 0.3f, int marginRows = 1);
+
+        void setFactory(Factory factory) { _factory = std::move(factory); }
+        void setBinder(Binder binder) { _binder = std::move(binder); }
+
+        /// Change the number of items (keeps the scroll position when possible)
+        void setItemCount(std::size_t count);
+        std::size_t getItemCount() const { return _itemCount; }
+
+        /// Rebind every pooled widget (call when the underlying data changed)
+        void invalidateItems();
+
+        // --- Scrolling ---
+        void scrollToRow(int row);
+        void scrollBy(int rows) { scrollToRow(_firstRow + rows); }
+        int getFirstRow() const { return _firstRow; }
+        int getTotalRows() const;
+
+        // --- Paging (one page = visibleRows) ---
+        void setPage(int page) override;
+        int getTotalPages() const override;
+        void nextPage() override;
+        void prevPage() override;
+
+        /// Position the visible widgets in the viewport grid
+        void recalculateLayout() override;
+
+        /// Item bound to a pooled widget, or kUnbound
+        std::size_t getItemIndex(const VRUIWidget* widget) const;
+
+    private:
+        struct PoolSlot
+        {
+            std::shared_ptr<VRUIWidget> widget;
+            std::size_t item = kUnbound;
+        };
+
+        /// Create pooled widgets up to the window size
+        void ensurePool();
+
+        /// Move the viewport (row already clamped) and rebind what entered the window
+        void setFirstRow(int row);
+
+        /// Bind the current window, reusing widgets whose item is still inside it
+        void rebindWindow(bool force);
+
+        int _columns;
+        int _visibleRows;
+        int _marginRows;
+        int _firstRow = 0;
+        std::size_t _itemCount = 0;
+
+        Factory _factory;
+        Binder _binder;
+        std::vector<PoolSlot> _pool;
+    };
+}
@@ -1,5 +1,9 @@
 #include "VRUIWidget.h"
 #include "VRUISettings.h"
+#include "VRUIAssetLoader.h"
+#include "VRUIModelResolver.h"
+#include "VRUIModelCache.h"
+#include "VRUIProceduralMesh.h"
 #include <RE/Skyrim.h>
 #include <CLIBUtil/numeric.hpp>
 #include <RE/B/BSEffectShaderProperty.h>
@@ -21,8 +25,6 @@
 
 namespace vrui
 {
-    std::map<std::string, RE::NiPointer<RE::NiNode>> VRUIWidget::_nifCache;
-
     // =====================================================================
     // AABB
     // =====================================================================
@@ -215,7 +217,8 @@ namespace vrui
         return box;
     }
 
-    bool VRUIWidget::hitTest(const RE::NiPoint3& rayOriginWorld, const RE::NiPoint3& rayDirWorld, float& outDistance) const
+    bool VRUIWidget::hitTest(const RE::NiPoint3& rayOriginWorld, const RE::NiPoint3& rayDirWorld, float& outDistance,
+                             const VRUISettings& settings) const
     {
         if (!_node) return false;
 
@@ -241,8 +244,8 @@ namespace vrui
 
         // 3. Perform AABB Check on Logical Dimensions
         AABB localAABB;
-        float hScale = VRUISettings::get().hitboxScale;
-        float depthScale = VRUISettings::get().hitTestDepth;
+        float hScale = settings.hitboxScale;
+        float depthScale = settings.hitTestDepth;
         float halfW = (_width * hScale) * 0.5f;
         float halfH = (_height * hScale) * 0.5f;
         
@@ -350,99 +353,97 @@ namespace vrui
     RE::NiPointer<RE::NiNode> VRUIWidget::loadModelFromNif(const std::string& nifPath)
     {
         // First, check the cache
-        auto it = _nifCache.find(nifPath);
-        if (it != _nifCache.end()) {
-            // Found in cache, return a clone
-            if (it->second) {
-                auto* cloned = it->second->Clone();
-                return RE::NiPointer<RE::NiNode>(cloned ? cloned->AsNode() : nullptr);
-            }
+        if (auto cached = VRUIModelCache::get().find(nifPath)) {
+            // Found in cache, return an instance of it
+            return VRUIModelCache::get().instantiate(cached.get());
         }
 
-        RE::NiPointer<RE::NiNode> modelRoot;
-        RE::BSModelDB::DBTraits::ArgsType args{};
-
-        // Try multiple path variations to be as robust as possible
-        std::vector<std::string> pathsToTry = { nifPath };
-        
-        // 1. Try with meshes\ prefix if not there
-        if (!nifPath.starts_with("meshes\\") && !nifPath.starts_with("meshes/")) {
-            pathsToTry.push_back("meshes\\" + nifPath);
-        } else {
-            // 2. Try without meshes\ prefix if it is there
-            size_t pos = nifPath.find_first_of("\\/");
-            if (pos != std::string::npos) {
-                pathsToTry.push_back(nifPath.substr(pos + 1));
-            }
-        }
-
-        RE::BSResource::ErrorCode result = RE::BSResource::ErrorCode::kNone;
-        bool found = false;
-
-        for (const auto& path : pathsToTry) {
-            result = RE::BSModelDB::Demand(path.c_str(), modelRoot, args);
-            if (result == RE::BSResource::ErrorCode::kNone && modelRoot) {
-                found = true;
-                logger::info("ImmersiveUI: BSModelDB::Demand success for path: '{}'", path);
-                break;
-            }
-        }
-
-        if (!found) {
-            logger::warn("ImmersiveUI: BSModelDB::Demand failed for '{}' (tried {} variations, last error={})",
-                nifPath, pathsToTry.size(), static_cast<int>(result));
+        auto modelRoot = demandModel(nifPath);
+        if (!modelRoot) {
             return nullptr;
         }
 
         // Store the original in cache
-        _nifCache[nifPath] = modelRoot;
+        cacheModel(nifPath, modelRoot);
         logger::info("ImmersiveUI: Loaded NIF '{}' via BSModelDB::Demand and cached it", nifPath);
 
         // Clone the loaded model so we have our own instance
-        auto* cloned = modelRoot->Clone();
-        if (!cloned) {
+        auto instance = VRUIModelCache::get().instantiate(modelRoot.get());
+        if (!instance) {
             logger::warn("ImmersiveUI: Failed to clone model '{}'", nifPath);
-            return nullptr;
         }
+        return instance;
+    }
 
-        auto* asNode = cloned->AsNode();
-        return RE::NiPointer<RE::NiNode>(asNode);
+    RE::NiPointer<RE::NiNode> VRUIWidget::demandModel(const std::string& nifPath)
+    {
+        // Path variants and remembered outcomes are handled by the resolver
+        return VRUIModelResolver::get().demand(nifPath);
+    }
+
+    RE::NiPointer<RE::NiNode> VRUIWidget::loadFirstModel(std::span<const char* const> candidates, std::string* outPath)
+    {
+        auto& resolver = VRUIModelResolver::get();
+        for (const char* path : candidates) {
+            // Candidates known to be missing cost nothing
+            if (resolver.isKnownMissing(path)) continue;
+
+            auto model = loadModelFromNif(path);
+            if (model) {
+                if (outPath) *outPath = path;
+                return model;
+            }
+        }
+        return nullptr;
+    }
+
+    bool VRUIWidget::isModelCached(std::string_view nifPath)
+    {
+        return VRUIModelCache::get().contains(nifPath);
+    }
+
+    void VRUIWidget::cacheModel(const std::string& nifPath, RE::NiPointer<RE::NiNode> root)
+    {
+        VRUIModelCache::get().insert(nifPath, std::move(root));
+    }
+
+    void VRUIWidget::loadModelAsync(const std::string& nifPath, std::function<void(RE::NiPointer<RE::NiNode>)> onReady)
+    {
+        VRUIAssetLoader::get().request(nifPath, _lifetimeToken, std::move(onReady));
     }
 
     RE::NiPointer<RE::NiNode> VRUIWidget::createQuadNode(
         const std::string& name, float width, float height,
-        [[maybe_unused]] const RE::NiColorA& color)
+        const RE::NiColorA& color)
     {
         // Create a container node for a quad panel.
-        // For visual geometry, we load a built-in game mesh and rescale it.
         auto node = RE::NiPointer<RE::NiNode>(RE::NiNode::Create(2));
         if (!node) return nullptr;
         node->name = name;
 
-        // Try loading a simple game marker mesh as a visual placeholder
-        RE::NiPointer<RE::NiNode> meshNode;
-        RE::BSModelDB::DBTraits::ArgsType args{};
-        args.postProcess = false;  // Skip post-processing for simple use
-
-        // Use a simple built-in mesh as the visual placeholder
-    // We try immersiveUI\slot01.nif because we know it exists from the logs
-    auto result = RE::BSModelDB::Demand("immersiveUI\\slot01.nif", meshNode, args);
-    if (result != RE::BSResource::ErrorCode::kNone) {
-        result = RE::BSModelDB::Demand("meshes\\immersiveUI\\slot01.nif", meshNode, args);
-    }
-    if (result != RE::BSResource::ErrorCode::kNone) {
-        result = RE::BSModelDB::Demand("meshes\\markers\\movemarker01.nif", meshNode, args);
-    }
-
-        if (result == RE::BSResource::ErrorCode::kNone && meshNode) {
-            // Clone and attach
-            auto* cloned = meshNode->Clone();
-            if (cloned && cloned->AsNode()) {
-                auto* cloneNode = cloned->AsNode();
-                cloneNode->local.scale = width * 0.1f;  // Scale to button size
-                node->AttachChild(cloneNode);
-                logger::info("ImmersiveUI: Created visual quad '{}' with game mesh", name);
-            }
+        // Generated quad of the requested size and colour when the quad pool is installed
+        if (auto quad = VRUIProceduralMesh::create(name + "_quad")) {
+            MeshData mesh;
+            appendQuad(mesh, MeshRect::centered(width, height), MeshColor{ color.red, color.green, color.blue, color.alpha });
+            quad->setMesh(mesh);
+            node->AttachChild(quad->getNode());
+            logger::trace("ImmersiveUI: Created procedural quad '{}' ({}x{})", name, width, height);
+            return node;
+        }
+
+        // Otherwise load a built-in game mesh and rescale it
+        // We try immersiveUI\slot01.nif because we know it exists from the logs
+        // (the resolver covers the meshes\ variant and remembers the outcome for every segment)
+        static constexpr const char* quadMeshPaths[] = {
+            "immersiveUI\\slot01.nif",
+            "markers\\movemarker01.nif"
+        };
+
+        auto meshNode = loadFirstModel(quadMeshPaths);
+        if (meshNode) {
+            meshNode->local.scale = width * 0.1f;  // Scale to button size
+            node->AttachChild(meshNode.get());
+            logger::trace("ImmersiveUI: Created visual quad '{}' with game mesh", name);
         } else {
             logger::warn("ImmersiveUI: Couldn't load visual mesh for '{}', using empty node", name);
         }
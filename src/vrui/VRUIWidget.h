@@ -2,13 +2,16 @@
 
 #include <RE/Skyrim.h>
 #include <functional>
-#include <map>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace vrui
 {
+    struct VRUISettings;
+
     /// Degrees-to-radians conversion constant (avoids magic numbers everywhere)
     inline constexpr float kDegToRad = 3.14159265f / 180.0f;
 
@@ -61,7 +64,9 @@ namespace vrui
 
         // --- Hit Testing ---
         AABB getWorldAABB() const;
-        bool hitTest(const RE::NiPoint3& rayOriginWorld, const RE::NiPoint3& rayDirWorld, float& outDistance) const;
+        /// Ray against the widget's hit volume (sized by `settings`' fHitboxScale / fHitTestDepth)
+        bool hitTest(const RE::NiPoint3& rayOriginWorld, const RE::NiPoint3& rayDirWorld, float& outDistance,
+                     const VRUISettings& settings) const;
         virtual RE::NiPoint2 calculateLogicalDimensions() const;
 
         float getWidth() const { return _width; }
@@ -91,11 +96,24 @@ namespace vrui
         /// Helper: load a NIF model using BSModelDB::Demand (game's native pipeline)
         static RE::NiPointer<RE::NiNode> loadModelFromNif(const std::string& nifPath);
 
+        /// Demand a model root without touching the cache (tries the meshes\ prefix variants).
+        /// Safe to call from the asset loader thread.
+        static RE::NiPointer<RE::NiNode> demandModel(const std::string& nifPath);
+
+        /// Load the first of `candidates` that exists; `outPath` receives the one used.
+        /// Candidates the resolver already knows are missing are skipped without probing.
+        static RE::NiPointer<RE::NiNode> loadFirstModel(std::span<const char* const> candidates, std::string* outPath = nullptr);
+
+        /// Cache access for the asset loader (main thread)
+        static bool isModelCached(std::string_view nifPath);
+        static void cacheModel(const std::string& nifPath, RE::NiPointer<RE::NiNode> root);
+
     protected:
         /// Creates the base NiNode. NOT virtual - safe to call from base constructor.
         void createNode();
 
-        /// Helper: creates a flat quad mesh (two triangles) as NiTriShape
+        /// Helper: flat `width` x `height` quad in the widget's XZ plane, generated from the
+        /// quad pool (VRUIProceduralMesh); a rescaled game mesh if the pool is not installed
         static RE::NiPointer<RE::NiNode> createQuadNode(
             const std::string& name, float width, float height,
             const RE::NiColorA& color);
@@ -103,6 +121,10 @@ namespace vrui
         /// Debug: log the node hierarchy starting from this widget's node
         void logNodeHierarchy(const std::string& context) const;
 
+        /// Load a model in the background; `onReady` runs on the main thread (immediately if
+        /// cached) and is dropped if this widget is destroyed first.
+        void loadModelAsync(const std::string& nifPath, std::function<void(RE::NiPointer<RE::NiNode>)> onReady);
+
         std::string _name;
         float _width;
         float _height;
@@ -115,9 +137,10 @@ namespace vrui
 
         RE::NiPointer<RE::NiNode> _node;
 
-        static std::map<std::string, RE::NiPointer<RE::NiNode>> _nifCache;
-
         VRUIWidget* _parent = nullptr;
         std::vector<std::shared_ptr<VRUIWidget>> _children;
+
+        /// Expires with the widget; async load callbacks hold a weak reference
+        std::shared_ptr<void> _lifetimeToken = std::make_shared<char>(0);
     };
 }
@@ -1,5 +1,9 @@
 set_xmakever('3.0.1')
-includes('lib/commonlibsse-ng')
+
+-- The plugin needs CommonLib and MSVC; the benchmarks below build anywhere
+if is_plat('windows') then
+    includes('lib/commonlibsse-ng')
+end
 
 set_project('ImmersiveUI')
 set_version('1.0.0')
@@ -8,7 +12,9 @@ set_license('GPL-3.0')
 set_languages('c++23')
 set_warnings('allextra')
 set_policy('package.requires_lock', true)
-set_toolset('msvc', 'ninja')
+if is_plat('windows') then
+    set_toolset('msvc', 'ninja')
+end
 
 add_rules('mode.debug', 'mode.releasedbg', 'mode.release')
 
@@ -30,49 +36,91 @@ option('skyrim_vr')
     set_description('Build for Skyrim VR only')
 option_end()
 
+option('bench')
+    set_default(false)
+    set_showmenu(true)
+    set_description('Build the ImmersiveUI_bench benchmarks (bench/)')
+option_end()
+
 if has_config('skyrim_vr') and (has_config('skyrim_se') or has_config('skyrim_ae')) then
     raise('Cannot combine Skyrim VR with SE/AE builds. Enable only one configuration.')
 end
 
-target('ImmersiveUI')
-    add_deps('commonlibsse-ng')
-
-    local runtime = 'se_ae'
-    if has_config('skyrim_vr') then
-        runtime = 'vr'
-    elseif has_config('skyrim_ae') and not has_config('skyrim_se') then
-        runtime = 'ae'
-    elseif has_config('skyrim_se') and not has_config('skyrim_ae') then
-        runtime = 'se'
-    end
-
-    add_rules('commonlibsse-ng.plugin', {
-        name        = 'ImmersiveUI',
-        author      = 'GabeAlvz',
-        description = 'VR Menu Framework - Interactive menus on non-dominant hand with raycast activation.',
-        runtime     = runtime
-    })
-
-    add_files('src/**.cpp')
-    add_headerfiles('src/**.h')
-
-    add_includedirs(
-        'src',
-        '$(projectdir)',
-        '$(projectdir)/ClibUtil/include',
-        '$(projectdir)/xbyak',
-        '$(projectdir)/simpleini'
-    )
-
-    set_pcxxheader('src/pch.h')
-
-    if has_config('skyrim_vr') then
-        add_defines('ENABLE_SKYRIM_VR')
-    elseif has_config('skyrim_se') and not has_config('skyrim_ae') then
-        add_defines('ENABLE_SKYRIM_SE')
-    elseif has_config('skyrim_ae') and not has_config('skyrim_se') then
-        add_defines('ENABLE_SKYRIM_AE')
-    else
-        add_defines('ENABLE_SKYRIM_SE')
-        add_defines('ENABLE_SKYRIM_AE')
-    end
+if is_plat('windows') then
+    target('ImmersiveUI')
+        add_deps('commonlibsse-ng')
+
+        local runtime = 'se_ae'
+        if has_config('skyrim_vr') then
+            runtime = 'vr'
+        elseif has_config('skyrim_ae') and not has_config('skyrim_se') then
+            runtime = 'ae'
+        elseif has_config('skyrim_se') and not has_config('skyrim_ae') then
+            runtime = 'se'
+        end
+
+        add_rules('commonlibsse-ng.plugin', {
+            name        = 'ImmersiveUI',
+            author      = 'GabeAlvz',
+            description = 'VR Menu Framework - Interactive menus on non-dominant hand with raycast activation.',
+            runtime     = runtime
+        })
+
+        add_files('src/**.cpp')
+        add_headerfiles('src/**.h')
+
+        add_includedirs(
+            'src',
+            '$(projectdir)',
+            '$(projectdir)/ClibUtil/include',
+            '$(projectdir)/xbyak',
+            '$(projectdir)/simpleini'
+        )
+
+        set_pcxxheader('src/pch.h')
+
+        if has_config('skyrim_vr') then
+            add_defines('ENABLE_SKYRIM_VR')
+        elseif has_config('skyrim_se') and not has_config('skyrim_ae') then
+            add_defines('ENABLE_SKYRIM_SE')
+        elseif has_config('skyrim_ae') and not has_config('skyrim_se') then
+            add_defines('ENABLE_SKYRIM_AE')
+        else
+            add_defines('ENABLE_SKYRIM_SE')
+            add_defines('ENABLE_SKYRIM_AE')
+        end
+end
+
+if has_config('bench') then
+    -- Benchmarks of the code that runs without the game (settings load, INI reader, ...).
+    -- No CommonLib: bench/pch.h stands in for src/pch.h, so this builds on Linux too.
+    target('ImmersiveUI_bench')
+        set_kind('binary')
+        set_default(false)
+
+        add_files('bench/*.cpp')
+        add_files(
+            'src/vrui/VRUIConfigWatcher.cpp',
+            'src/vrui/VRUISettings.cpp',
+            'src/vrui/VRUISettingsSchema.cpp',
+            'src/vrui/VRUISettingsCache.cpp',
+            'src/vrui/VRUISettingsWriter.cpp',
+            'src/vrui/VRUIIniReader.cpp',
+            'src/vrui/VRUIMappedFile.cpp',
+            'src/vrui/VRUISlotTable.cpp'
+        )
+
+        add_includedirs(
+            'src',
+            '$(projectdir)',
+            '$(projectdir)/ClibUtil/include'
+        )
+
+        set_pcxxheader('bench/pch.h')
+        set_rundir('$(projectdir)')
+
+        if not is_plat('windows') then
+            add_defines('SI_NO_CONVERSION')  -- SimpleIni's UTF-8 conversion is Win32-only here
+            add_syslinks('pthread')
+        end
+end